@@ -0,0 +1,130 @@
+#include <aul/containers/Circular_array.hpp>
+#include <aul/containers/Mpmc_circular_array.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//=========================================================
+// Queues under test
+//=========================================================
+
+///
+/// Baseline: an aul::Circular_array protected by a mutex, bounded to the
+/// same capacity as the lock-free queue
+///
+class Locked_circular_array {
+public:
+
+    explicit Locked_circular_array(std::size_t n):
+        limit(n) {
+        elements.reserve(n);
+    }
+
+    bool try_push(std::uint64_t v) {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (elements.size() == limit) {
+            return false;
+        }
+        elements.push_back(v);
+        return true;
+    }
+
+    bool try_pop(std::uint64_t& out) {
+        std::lock_guard<std::mutex> lock{mutex};
+        if (elements.empty()) {
+            return false;
+        }
+        out = elements.front();
+        elements.pop_front();
+        return true;
+    }
+
+private:
+
+    std::mutex mutex;
+    aul::Circular_array<std::uint64_t> elements;
+    std::size_t limit;
+
+};
+
+//=========================================================
+// Benchmark driver
+//=========================================================
+
+///
+/// \return Elements transferred per second
+template<class Q>
+double run(const unsigned producers, const unsigned consumers, const std::uint64_t per_producer, const std::size_t capacity) {
+    Q queue{capacity};
+
+    const std::uint64_t total = per_producer * producers;
+    std::atomic<std::uint64_t> popped{0};
+    std::atomic<std::uint64_t> checksum{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (unsigned p = 0; p < producers; ++p) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {}
+            for (std::uint64_t i = 0; i < per_producer; ++i) {
+                while (!queue.try_push(i)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+
+    for (unsigned c = 0; c < consumers; ++c) {
+        threads.emplace_back([&] {
+            while (!go.load(std::memory_order_acquire)) {}
+            std::uint64_t sum = 0;
+            std::uint64_t v = 0;
+            while (popped.load(std::memory_order_relaxed) < total) {
+                if (queue.try_pop(v)) {
+                    sum += v;
+                    popped.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            checksum.fetch_add(sum);
+        });
+    }
+
+    const auto start = std::chrono::steady_clock::now();
+    go.store(true, std::memory_order_release);
+    for (auto& t : threads) {
+        t.join();
+    }
+    const auto stop = std::chrono::steady_clock::now();
+
+    const std::uint64_t expected = producers * (per_producer * (per_producer - 1) / 2);
+    if (checksum.load() != expected) {
+        std::fprintf(stderr, "Checksum mismatch\n");
+        std::exit(EXIT_FAILURE);
+    }
+
+    return static_cast<double>(total) / std::chrono::duration<double>(stop - start).count();
+}
+
+int main(int argc, char* argv[]) {
+    const std::uint64_t per_producer = (argc > 1) ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+    const std::size_t capacity = 1024;
+
+    const unsigned configurations[][2] = {{1, 1}, {2, 2}, {4, 4}, {1, 4}, {4, 1}};
+
+    std::printf("%-10s %-10s %18s %18s\n", "producers", "consumers", "mutex (ops/s)", "mpmc (ops/s)");
+    for (const auto& config : configurations) {
+        const double locked = run<Locked_circular_array>(config[0], config[1], per_producer, capacity);
+        const double lock_free = run<aul::Mpmc_circular_array<std::uint64_t>>(config[0], config[1], per_producer, capacity);
+        std::printf("%-10u %-10u %18.0f %18.0f\n", config[0], config[1], locked, lock_free);
+    }
+
+    return EXIT_SUCCESS;
+}
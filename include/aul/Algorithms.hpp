@@ -3,9 +3,20 @@
 
 #include "Bits.hpp"
 
+#include <cstddef>
+#include <cstdint>
+#include <exception>
 #include <iterator>
 #include <functional>
+#include <limits>
 #include <memory>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 //TODO: Remove use of this header
 #include <algorithm>
@@ -76,43 +87,177 @@ namespace aul {
         return linear_search(begin, begin + size, val, c);
     }
 
-    /*
+    namespace impl {
+
+        ///
+        /// \param p Pointer to array of elements
+        /// \param n Number of elements
+        /// \param val Value to compare against
+        /// \return Number of elements in p which are less than val
+        template<class T>
+        [[nodiscard]]
+        std::ptrdiff_t count_less(const T* p, const std::ptrdiff_t n, const T val) noexcept {
+            std::ptrdiff_t count = 0;
+            std::ptrdiff_t i = 0;
+
+            //Comparison results are all ones, i.e. -1, in lanes where the
+            //element is less than val, so they are subtracted from a per-lane
+            //count which is summed once at the end
+
+            #if defined(__AVX2__)
+            constexpr bool is_int32 = std::is_integral<T>::value && sizeof(T) == 4;
+            constexpr bool is_int64 = std::is_integral<T>::value && sizeof(T) == 8;
+
+            //AVX2 only has signed integer comparisons so sign bits are
+            //flipped for unsigned types
+            constexpr bool flip = std::is_unsigned<T>::value;
+
+            __m256i counts = _mm256_setzero_si256();
+
+            if constexpr (std::is_same<T, float>::value) {
+                const __m256 v = _mm256_set1_ps(val);
+                for (; i + 8 <= n; i += 8) {
+                    const __m256 lt = _mm256_cmp_ps(_mm256_loadu_ps(p + i), v, _CMP_LT_OQ);
+                    counts = _mm256_sub_epi32(counts, _mm256_castps_si256(lt));
+                }
+            } else if constexpr (std::is_same<T, double>::value) {
+                const __m256d v = _mm256_set1_pd(val);
+                for (; i + 4 <= n; i += 4) {
+                    const __m256d lt = _mm256_cmp_pd(_mm256_loadu_pd(p + i), v, _CMP_LT_OQ);
+                    counts = _mm256_sub_epi64(counts, _mm256_castpd_si256(lt));
+                }
+            } else if constexpr (is_int32) {
+                const __m256i sign = _mm256_set1_epi32(flip ? std::numeric_limits<std::int32_t>::min() : 0);
+                const __m256i v = _mm256_xor_si256(_mm256_set1_epi32(std::int32_t(val)), sign);
+                for (; i + 8 <= n; i += 8) {
+                    const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), sign);
+                    counts = _mm256_sub_epi32(counts, _mm256_cmpgt_epi32(v, x));
+                }
+            } else if constexpr (is_int64) {
+                const __m256i sign = _mm256_set1_epi64x(flip ? std::numeric_limits<std::int64_t>::min() : 0);
+                const __m256i v = _mm256_xor_si256(_mm256_set1_epi64x(std::int64_t(val)), sign);
+                for (; i + 4 <= n; i += 4) {
+                    const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)), sign);
+                    counts = _mm256_sub_epi64(counts, _mm256_cmpgt_epi64(v, x));
+                }
+            }
+
+            if constexpr (std::is_same<T, double>::value || is_int64) {
+                alignas(32) std::int64_t lanes[4];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counts);
+                count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            } else if constexpr (std::is_same<T, float>::value || is_int32) {
+                alignas(32) std::int32_t lanes[8];
+                _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), counts);
+                for (std::int32_t lane : lanes) {
+                    count += lane;
+                }
+            }
+
+            #elif defined(__SSE2__)
+            if constexpr (std::is_same<T, float>::value) {
+                const __m128 v = _mm_set1_ps(val);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 4 <= n; i += 4) {
+                    counts = _mm_sub_epi32(counts, _mm_castps_si128(_mm_cmplt_ps(_mm_loadu_ps(p + i), v)));
+                }
+
+                alignas(16) std::int32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), counts);
+                count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            } else if constexpr (std::is_integral<T>::value && sizeof(T) == 4) {
+                const __m128i sign = _mm_set1_epi32(std::is_unsigned<T>::value ? std::numeric_limits<std::int32_t>::min() : 0);
+                const __m128i v = _mm_xor_si128(_mm_set1_epi32(std::int32_t(val)), sign);
+                __m128i counts = _mm_setzero_si128();
+                for (; i + 4 <= n; i += 4) {
+                    const __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i)), sign);
+                    counts = _mm_sub_epi32(counts, _mm_cmplt_epi32(x, v));
+                }
+
+                alignas(16) std::int32_t lanes[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(lanes), counts);
+                count = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+            }
+            #endif
+
+            //Remaining elements, or all of them for other types. Written
+            //without branches so that it may be auto-vectorized
+            for (; i < n; ++i) {
+                count += std::ptrdiff_t(p[i] < val);
+            }
+
+            return count;
+        }
+
+    }
+
+    ///
+    /// Equivalent to std::lower_bound(begin, end, val) for arithmetic types
+    /// ordered by operator<.
+    ///
+    /// The range is narrowed with a branchless binary search until it spans
+    /// at most 256 bytes. The final block is then resolved by counting the
+    /// elements less than val using vector comparisons, which is possible
+    /// without any branches since the elements are sorted.
     ///
-    /// \tparam R_iter Randomc access iterator type
+    /// \tparam T Arithmetic type
+    /// \param begin Pointer to beginning of sorted range
+    /// \param end Pointer to end of sorted range
+    /// \param val Value to search for
+    /// \return Pointer to first element not less than val
+    template<class T>
+    [[nodiscard]]
+    const T* vectorized_lower_bound(const T* begin, const T* end, const T val) noexcept {
+        static_assert(std::is_arithmetic<T>::value, "aul::vectorized_lower_bound requires an arithmetic type");
+
+        constexpr std::ptrdiff_t block_size = 256 / sizeof(T);
+
+        std::ptrdiff_t size = end - begin;
+        while (size > block_size) {
+            const std::ptrdiff_t half = size / 2;
+            begin = (begin[half] < val) ? begin + half : begin;
+            size -= half;
+        }
+
+        return begin + impl::count_less(begin, size, val);
+    }
+
+    ///
+    /// Searches for val by probing positions at exponentially increasing
+    /// distances from begin until an element not less than val is found,
+    /// and then performing a binary search over the last interval. Takes
+    /// O(log d) comparisons, where d is the distance from begin to the
+    /// result, making it well suited to successive searches for increasing
+    /// values.
+    ///
+    /// \tparam R_iter Random access iterator type
     /// \tparam T Object Type to compare to
     /// \tparam C Comparator type
     /// \param begin Iterator to begining of range
     /// \param end Iterator to end of range
     /// \param val Value to compare against
     /// \param c Comparator object
+    /// \return Iterator to location where val is expected to be, even if it's
+    ///     found at that location.
     template<class R_iter, class T, class C = std::less<T>>
     [[nodiscard]]
     constexpr R_iter exponential_search(R_iter begin, R_iter end, const T& val, C c = {}) {
-        using diff_type = std::iterator_traits<R_iter>::difference_type;
-
-        diff_type size = (end - begin);
-        diff_type offset = 1;
-
-        R_iter a = begin;
-        R_iter b = begin;
-        while (b != end) {
-            if (c(val, *b)) {
-                return binary_search(a, b, val, c);
-            }
+        using diff_type = typename std::iterator_traits<R_iter>::difference_type;
 
-            a = b;
-            b = b + offset;
+        const diff_type size = (end - begin);
 
-            if ((size / 2) < offset) {
-                offset = size;
-            } else {
-                offset *= 2;
-            }
+        //The result lies within [lo, hi]
+        diff_type lo = 0;
+        diff_type hi = 0;
+        diff_type offset = 1;
+        while (hi < size && c(begin[hi], val)) {
+            lo = hi + 1;
+            hi = (size - hi < offset) ? size : hi + offset;
+            offset *= 2;
         }
 
-        return end;
+        return aul::binary_search(begin + lo, begin + hi, val, c);
     }
-    */
 
     ///
     /// Remove consecutive elements in the range specified by [begin, end) when
@@ -141,6 +286,127 @@ namespace aul {
         return ++a;
     }
 
+    namespace impl {
+
+        ///
+        /// \param thread_count Requested number of threads. Zero selects the
+        ///     number of hardware threads
+        /// \param n Number of elements to be processed
+        /// \param min_chunk Fewest elements worth handing to a thread
+        /// \return Number of chunks [0, n) should be split into
+        inline std::size_t chunk_count(std::size_t thread_count, const std::size_t n, const std::size_t min_chunk) {
+            if (thread_count == 0) {
+                thread_count = std::max(std::thread::hardware_concurrency(), 1u);
+            }
+
+            return std::max(std::min(thread_count, n / std::max(min_chunk, std::size_t{1})), std::size_t{1});
+        }
+
+        ///
+        /// Splits [0, n) into the specified number of contiguous chunks of
+        /// near equal size and invokes f(i, begin, end) on each, where i is
+        /// the index of the chunk. Each chunk but the first is handled by a
+        /// thread of its own while the calling thread handles the first. If
+        /// a thread cannot be started, its chunk is handled by the calling
+        /// thread instead.
+        ///
+        /// Once all invocations have completed, the first exception thrown by
+        /// any of them is rethrown.
+        ///
+        /// \tparam F Callable object type
+        /// \param n Number of elements
+        /// \param chunks Number of chunks to split elements into
+        /// \param f Callable object to invoke on each chunk
+        template<class F>
+        void parallel_chunks(const std::size_t n, const std::size_t chunks, F f) {
+            std::vector<std::exception_ptr> exceptions(chunks);
+
+            auto invoke = [&] (const std::size_t i) {
+                try {
+                    f(i, (n * i) / chunks, (n * (i + 1)) / chunks);
+                } catch (...) {
+                    exceptions[i] = std::current_exception();
+                }
+            };
+
+            std::vector<std::thread> threads;
+            threads.reserve(chunks);
+            for (std::size_t i = 1; i < chunks; ++i) {
+                try {
+                    threads.emplace_back(invoke, i);
+                } catch (...) {
+                    invoke(i);
+                }
+            }
+
+            invoke(0);
+
+            for (auto& thread : threads) {
+                thread.join();
+            }
+
+            for (auto& e : exceptions) {
+                if (e) {
+                    std::rethrow_exception(e);
+                }
+            }
+        }
+
+    }
+
+    ///
+    /// Sorts the range [begin, end) using multiple threads. The range is
+    /// split into one chunk per thread which are sorted concurrently, after
+    /// which neighbouring chunks are merged pairwise, again concurrently,
+    /// until a single sorted range remains.
+    ///
+    /// Small ranges are sorted on the calling thread.
+    ///
+    /// The sort is not stable. c may be invoked concurrently from several
+    /// threads.
+    ///
+    /// \tparam R_iter Random-access iterator type
+    /// \tparam C Comparator type
+    /// \param begin Iterator to beginning of range
+    /// \param end Iterator to end of range
+    /// \param c Comparator object to use
+    /// \param thread_count Maximum number of threads to use. Zero selects the
+    ///     number of hardware threads
+    template<class R_iter, class C = std::less<>>
+    void parallel_sort(R_iter begin, R_iter end, C c = {}, const std::size_t thread_count = 0) {
+        constexpr std::size_t min_chunk = 1 << 14;
+
+        const auto n = static_cast<std::size_t>(end - begin);
+        const std::size_t chunks = impl::chunk_count(thread_count, n, min_chunk);
+        if (chunks == 1) {
+            std::sort(begin, end, c);
+            return;
+        }
+
+        auto boundary = [&] (const std::size_t i) {
+            return begin + ((n * i) / chunks);
+        };
+
+        impl::parallel_chunks(n, chunks, [&] (std::size_t, std::size_t lo, std::size_t hi) {
+            std::sort(begin + lo, begin + hi, c);
+        });
+
+        //Runs of sorted chunks double in length with each round of merges
+        for (std::size_t width = 1; width < chunks; width *= 2) {
+            const std::size_t merges = (chunks + 2 * width - 1) / (2 * width);
+
+            impl::parallel_chunks(merges, merges, [&] (std::size_t i, std::size_t, std::size_t) {
+                const std::size_t first = 2 * width * i;
+                const std::size_t middle = std::min(first + width, chunks);
+                const std::size_t last = std::min(first + 2 * width, chunks);
+
+                if (middle != last) {
+                    std::inplace_merge(boundary(first), boundary(middle), boundary(last), c);
+                }
+            });
+        }
+    }
+
     template<class...Args>
     void no_op(const Args&...) {}
 
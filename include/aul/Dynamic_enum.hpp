@@ -120,7 +120,7 @@ namespace aul {
         }
 
         static Dynamic_enum get_or_create_value(const std::string& name) {
-            auto it = names_to_values.find(std::reference_wrapper<const std::string>{name});
+            auto it = names_to_values.find(name);
             if (it != names_to_values.end()) {
                 return Dynamic_enum{std::get<1>(*it)};
             }
@@ -237,7 +237,7 @@ namespace aul {
         ///
         /// Map associating enum names with their backing type
         ///
-        static aul::Array_map<std::string, backing_type> names_to_values;
+        static aul::Array_map<std::string, backing_type, std::less<>> names_to_values;
 
         ///
         /// Variable which determines which enum value is taken by new instance
@@ -270,7 +270,7 @@ namespace aul {
     aul::Array_map<I, std::string> Dynamic_enum<Tag, I>::values_to_names{};
 
     template<class Tag, class I>
-    aul::Array_map<std::string, I> Dynamic_enum<Tag, I>::names_to_values{};
+    aul::Array_map<std::string, I, std::less<>> Dynamic_enum<Tag, I>::names_to_values{};
 
     template<class Tag, class I>
     I Dynamic_enum<Tag, I>::default_value = 0;
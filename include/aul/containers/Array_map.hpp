@@ -3,6 +3,7 @@
 
 #include "Zipper_iterator.hpp"
 #include "Allocator_aware_base.hpp"
+#include "SBO_base.hpp"
 
 #include "../Span.hpp"
 #include "../memory/Memory.hpp"
@@ -12,13 +13,264 @@
 #include <type_traits>
 #include <limits>
 #include <algorithm>
+#include <cmath>
+#include <cstddef>
 #include <functional>
+#include <iterator>
+#include <numeric>
 #include <tuple>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace aul {
 
+    ///
+    /// Layout policy for aul::Array_map under which lookups perform a binary
+    /// search directly over the sorted key array. Requires no additional
+    /// memory.
+    ///
+    struct Sorted_layout {};
+
+    ///
+    /// Layout policy for aul::Array_map under which a copy of the keys is
+    /// additionally kept in Eytzinger (breadth-first) order, alongside the
+    /// position of each key in the sorted key array.
+    ///
+    /// Lookups descend the implicit tree with prefetching of the next few
+    /// levels, so that each cache line fetched serves several comparisons,
+    /// and then translate the result to a position in the sorted arrays.
+    /// Iteration, keys(), and values() are unaffected and remain in order.
+    ///
+    /// The copy is rebuilt in linear time after each modification, making
+    /// this layout best suited to maps which are read far more often than
+    /// they are modified. Keys must be copy constructible.
+    ///
+    struct Eytzinger_layout {};
+
+    ///
+    /// Execution policy which may be passed to the constructors of
+    /// aul::Array_map to have the elements sorted, and checked for duplicate
+    /// keys, using multiple threads
+    ///
+    struct Parallel_execution {
+        ///
+        /// Maximum number of threads to use. Zero selects the number of
+        /// hardware threads
+        ///
+        std::size_t thread_count = 0;
+    };
+
+    ///
+    /// Search structure used by aul::Array_map to find keys according to
+    /// the layout policy L
+    ///
+    /// \tparam L Layout policy
+    /// \tparam K Key type
+    /// \tparam A Allocator type
+    template<class L, class K, class A>
+    class Array_map_index;
+
+    template<class K, class A>
+    class Array_map_index<Sorted_layout, K, A> {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Array_map_index() = default;
+
+        explicit Array_map_index(const A&) noexcept {}
+
+        //=================================================
+        // Methods
+        //=================================================
+
+        template<class P>
+        void rebuild(P, size_type) noexcept {}
+
+        void clear() noexcept {}
+
+        ///
+        /// Arithmetic keys ordered by std::less are searched using
+        /// aul::vectorized_lower_bound
+        ///
+        /// \param sorted_keys Pointer to sorted key array
+        /// \param n Number of keys
+        /// \param key Key to search for
+        /// \param c Comparator object
+        /// \return Pointer to first key not less than key
+        template<class P, class K2, class C>
+        [[nodiscard]]
+        P lower_bound(P sorted_keys, const size_type n, const K2& key, const C& c) const {
+            constexpr bool is_vectorizable =
+                std::is_arithmetic<K>::value &&
+                std::is_same<K2, K>::value &&
+                std::is_same<P, K*>::value &&
+                (std::is_same<C, std::less<K>>::value || std::is_same<C, std::less<>>::value);
+
+            if constexpr (is_vectorizable) {
+                return sorted_keys + (aul::vectorized_lower_bound<K>(sorted_keys, sorted_keys + n, key) - sorted_keys);
+            } else {
+                return aul::binary_search(sorted_keys, sorted_keys + n, key, c);
+            }
+        }
+
+    };
+
+    template<class K, class A>
+    class Array_map_index<Eytzinger_layout, K, A> {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Array_map_index(const A& alloc = A{}):
+            keys(key_allocator_type{alloc}),
+            ranks(rank_allocator_type{alloc}) {}
+
+        //=================================================
+        // Methods
+        //=================================================
+
+        ///
+        /// \param sorted_keys Pointer to sorted key array
+        /// \param n Number of keys
+        template<class P>
+        void rebuild(P sorted_keys, const size_type n) {
+            clear();
+
+            ranks.resize(n);
+            size_type next_rank = 0;
+            assign_ranks(1, next_rank);
+
+            keys.reserve(n);
+            for (size_type i = 0; i < n; ++i) {
+                keys.push_back(sorted_keys[ranks[i]]);
+            }
+        }
+
+        void clear() noexcept {
+            keys.clear();
+            ranks.clear();
+        }
+
+        ///
+        /// Falls back to a binary search over the sorted keys if the index
+        /// does not describe n keys, e.g. because rebuilding it failed
+        ///
+        /// \param sorted_keys Pointer to sorted key array
+        /// \param n Number of keys
+        /// \param key Key to search for
+        /// \param c Comparator object
+        /// \return Pointer to first key not less than key
+        template<class P, class K2, class C>
+        [[nodiscard]]
+        P lower_bound(P sorted_keys, const size_type n, const K2& key, const C& c) const {
+            if (keys.size() != n) {
+                return aul::binary_search(sorted_keys, sorted_keys + n, key, c);
+            }
+
+            const K* tree = keys.data();
+
+            //Nodes are numbered from 1 so that node k's children are 2k and 2k + 1
+            size_type k = 1;
+            while (k <= n) {
+                #if defined(__GNUC__) || defined(__clang__)
+                //Node k's descendants four levels down are contiguous
+                __builtin_prefetch(tree + (std::min(16 * k, n) - 1));
+                #endif
+
+                k = 2 * k + size_type(c(tree[k - 1], key));
+            }
+
+            //Undo the right turns taken after the last left turn
+            k >>= aul::log2(~k & (k + 1));
+
+            return sorted_keys + (k ? ranks[k - 1] : n);
+        }
+
+    private:
+
+        using key_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<K>;
+        using rank_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<size_type>;
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        ///
+        /// Keys in Eytzinger order
+        ///
+        std::vector<K, key_allocator_type> keys;
+
+        ///
+        /// Position of each key in the sorted key array
+        ///
+        std::vector<size_type, rank_allocator_type> ranks;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// Assigns sorted positions to the subtree rooted at node k through an
+        /// in-order traversal
+        ///
+        /// \param k Node number
+        /// \param next_rank Sorted position to assign to next node visited
+        void assign_ranks(const size_type k, size_type& next_rank) noexcept {
+            if (k > ranks.size()) {
+                return;
+            }
+
+            assign_ranks(2 * k, next_rank);
+            ranks[k - 1] = next_rank++;
+            assign_ranks(2 * k + 1, next_rank);
+        }
+
+    };
+
+    namespace impl {
+
+        ///
+        /// \return Offset of value array within an Array_map's small buffer
+        template<class K, class V, std::size_t N>
+        constexpr std::size_t array_map_small_vals_offset() {
+            return (N * sizeof(K) + alignof(V) - 1) / alignof(V) * alignof(V);
+        }
+
+        ///
+        /// Type of buffer used to store up to N keys and values inline
+        ///
+        template<class K, class V, std::size_t N>
+        using Array_map_small_buffer = SBO_base<
+            N ? array_map_small_vals_offset<K, V, N>() + N * sizeof(V) : 0,
+            (alignof(K) < alignof(V)) ? alignof(V) : alignof(K)
+        >;
+
+        template<class C, class = void>
+        struct is_transparent_comparator : std::false_type {};
+
+        template<class C>
+        struct is_transparent_comparator<C, std::void_t<typename C::is_transparent>> : std::true_type {};
+
+    }
+
     ///
     /// An associative container implemented using two parallel arrays
     /// containing keys and values.
@@ -27,9 +279,21 @@ namespace aul {
     /// \tparam V Element type
     /// \tparam C Comparator type
     /// \tparam A Allocator type
-    template<typename K, typename V, typename C = std::less<K>, typename A = std::allocator<V>>
-    class Array_map : public Allocator_aware_base<A> {
+    /// \tparam L Layout policy. Either aul::Sorted_layout or
+    ///     aul::Eytzinger_layout
+    /// \tparam N Number of keys and values which may be stored inside the
+    ///     object itself before the heap is used. See aul::Small_array_map
+    template<
+        typename K,
+        typename V,
+        typename C = std::less<K>,
+        typename A = std::allocator<V>,
+        typename L = Sorted_layout,
+        std::size_t N = 0
+    >
+    class Array_map : public Allocator_aware_base<A>, private impl::Array_map_small_buffer<K, V, N> {
         using base = Allocator_aware_base<A>;
+        using small_buffer_base = impl::Array_map_small_buffer<K, V, N>;
 
         //=================================================
         // Forward declarations
@@ -38,6 +302,30 @@ namespace aul {
         class Allocation;
         class Value_comparator;
 
+        //=================================================
+        // Helper traits
+        //=================================================
+
+        ///
+        /// True if keys of type K2 may be used for lookups without first
+        /// being converted to key_type, i.e. if the comparator is
+        /// transparent
+        ///
+        template<class K2>
+        static constexpr bool is_transparent =
+            impl::is_transparent_comparator<C>::value &&
+            !std::is_same<std::decay_t<K2>, K>::value;
+
+        ///
+        /// True if objects of type K2 may be used for lookups, either
+        /// directly or after being converted to key_type
+        ///
+        template<class K2>
+        static constexpr bool is_key_like =
+            std::is_same<K2, K>::value ||
+            is_transparent<K2> ||
+            std::is_convertible<const K2&, K>::value;
+
     public:
 
         //=================================================
@@ -53,6 +341,8 @@ namespace aul {
         using value_compare = Value_comparator;
         using key_compare = C;
 
+        using layout_type = L;
+
         using value_pointer = typename std::allocator_traits<value_allocator_type>::pointer;
         using const_value_pointer = typename std::allocator_traits<value_allocator_type>::const_pointer;
 
@@ -80,13 +370,15 @@ namespace aul {
         /// \param allocator Allocator object to copy
         explicit Array_map(const key_compare compare, const value_allocator_type& alloc = {}):
             base{alloc},
-            comparator{compare} {}
+            comparator{compare},
+            search_index{alloc} {}
 
         /// Construct with allocator
         ///
         /// \param allocator Allocator object to copy
         explicit Array_map(const value_allocator_type& allocator):
-            base{allocator} {}
+            base{allocator},
+            search_index{allocator} {}
 
         /// Copy constructor
         ///
@@ -96,16 +388,22 @@ namespace aul {
         /// \param arr Object to copy
         Array_map(const Array_map& arr):
             base{arr.get_allocator()},
-            allocation{allocate(arr.elem_count)},
             comparator{arr.comparator},
-            elem_count{arr.elem_count} {
+            elem_count{arr.elem_count},
+            buffer_count{arr.buffer_count},
+            search_index{arr.get_allocator()} {
+
+            allocation = allocate(elem_count);
 
             try {
                 copy_elements(arr.allocation, allocation, elem_count);
             } catch(...) {
                 deallocate(allocation);
                 elem_count = 0;
+                buffer_count = 0;
             }
+
+            update_index();
         }
 
         /// Allocator-extended copy constructor
@@ -114,16 +412,22 @@ namespace aul {
         /// \param allocator Allocator to copy for copy of arr
         Array_map(const Array_map& arr, const value_allocator_type& allocator):
             base{allocator},
-            allocation(allocate(arr.elem_count)),
             comparator(arr.comparator),
-            elem_count(arr.elem_count) {
+            elem_count(arr.elem_count),
+            buffer_count(arr.buffer_count),
+            search_index(allocator) {
+
+            allocation = allocate(elem_count);
 
             try {
                 copy_elements(arr.allocation, allocation, elem_count);
             } catch(...) {
                 deallocate(allocation);
                 elem_count = 0;
+                buffer_count = 0;
             }
+
+            update_index();
         }
 
         ///
@@ -134,9 +438,11 @@ namespace aul {
         ///
         Array_map(Array_map&& arr) noexcept:
             base{arr.get_allocator()},
-            allocation{std::move(arr.allocation)},
             comparator{std::move(arr.comparator)},
-            elem_count(std::exchange(arr.elem_count, 0)) {}
+            search_index{std::move(arr.search_index)} {
+
+            take_allocation(arr);
+        }
 
         ///
         /// Allocator-extended move constructor. If new allocator does not
@@ -149,7 +455,8 @@ namespace aul {
             base{alloc},
             allocation{(arr.allocator != alloc) ? allocate(elem_count) : std::move(allocation)},
             comparator{std::move(arr.comparator)},
-            elem_count{arr.elem_count} {
+            elem_count{arr.elem_count},
+            search_index{std::move(arr.search_index)} {
 
             if (arr.allocator != alloc) {
                 move_elements(alloc.allocation, allocation);
@@ -166,12 +473,13 @@ namespace aul {
             const value_allocator_type& alloc
         ):
             base{alloc},
-            allocation{allocate(std::distance(begin, end))},
             comparator{std::move(compare)},
             elem_count{std::distance(begin, end)}
         {
             using std::get;
 
+            allocation = allocate(elem_count);
+
             auto values_begin = get<0>(begin);
             auto values_end = get<0>(end);
             auto value_allocator = get_allocator();
@@ -192,6 +500,151 @@ namespace aul {
             if (duplicate_it != keys_end) {
                 throw std::runtime_error("Duplicate keys passed to Array_map constructor.");
             }
+
+            update_index();
+        }
+
+        ///
+        /// Constructs an Array_map from the key-value pairs in the range
+        /// [begin, end), using multiple threads to sort them and to check for
+        /// duplicate keys.
+        ///
+        /// The pairs are first copied into a scratch buffer. Indices into it
+        /// are then sorted with aul::parallel_sort, and the elements are moved
+        /// into place in parallel.
+        ///
+        /// The comparator may be invoked concurrently from several threads.
+        ///
+        /// \tparam It Forward iterator type whose elements are tuple-like
+        ///     key-value pairs
+        /// \param policy Parallel execution policy
+        /// \param begin Iterator to first key-value pair
+        /// \param end Iterator past last key-value pair
+        /// \param compare Comparator used to order keys
+        /// \param alloc Allocator to copy
+        template<class It>
+        Array_map(
+            Parallel_execution policy,
+            It begin,
+            It end,
+            const key_compare compare = {},
+            const value_allocator_type& alloc = {}
+        ):
+            base{alloc},
+            comparator{std::move(compare)},
+            search_index{alloc} {
+
+            using std::get;
+
+            const auto n = static_cast<size_type>(std::distance(begin, end));
+            if (!n) {
+                return;
+            }
+
+            if (max_size() < n) {
+                throw std::length_error("aul::Array_map grew too big");
+            }
+
+            //Elements are copied to scratch space first since the input need
+            //not be random-access
+            auto batch_allocator = get_allocator();
+            Allocation batch = allocate(batch_allocator, n);
+
+            size_type constructed = 0;
+            try {
+                for (; begin != end; ++begin, ++constructed) {
+                    auto&& pair = *begin;
+                    construct_key(batch.keys + constructed, get<0>(pair));
+                    try {
+                        construct_val(batch.vals + constructed, get<1>(pair));
+                    } catch (...) {
+                        destroy_key(batch.keys + constructed);
+                        throw;
+                    }
+                }
+            } catch (...) {
+                destroy_elements(batch, constructed);
+                deallocate(batch);
+                throw;
+            }
+
+            const std::size_t chunks = impl::chunk_count(policy.thread_count, n, min_parallel_chunk);
+
+            //Range of elements each chunk has constructed, so that they can be
+            //destroyed if another chunk throws
+            std::vector<std::pair<std::size_t, std::size_t>> constructed_ranges;
+
+            try {
+                constructed_ranges.resize(chunks);
+
+                index_vector order(n, index_allocator_type{get_allocator()});
+                std::iota(order.begin(), order.end(), size_type{0});
+                aul::parallel_sort(order.begin(), order.end(), [this, &batch] (size_type a, size_type b) {
+                    return comparator(batch.keys[a], batch.keys[b]);
+                }, policy.thread_count);
+
+                allocation = allocate(n);
+
+                impl::parallel_chunks(n, chunks, [this, &batch, &order, &constructed_ranges] (std::size_t c, std::size_t lo, std::size_t hi) {
+                    auto& range = constructed_ranges[c];
+                    range = {lo, lo};
+
+                    for (std::size_t i = lo; i < hi; ++i) {
+                        construct_key(allocation.keys + i, std::move(batch.keys[order[i]]));
+                        try {
+                            construct_val(allocation.vals + i, std::move(batch.vals[order[i]]));
+                        } catch (...) {
+                            destroy_key(allocation.keys + i);
+                            throw;
+                        }
+
+                        range.second = i + 1;
+                    }
+                });
+            } catch (...) {
+                for (const auto& range : constructed_ranges) {
+                    for (std::size_t i = range.first; i < range.second; ++i) {
+                        destroy_val(allocation.vals + i);
+                        destroy_key(allocation.keys + i);
+                    }
+                }
+
+                deallocate(allocation);
+                destroy_elements(batch, n);
+                deallocate(batch);
+                throw;
+            }
+
+            elem_count = n;
+
+            destroy_elements(batch, n);
+            deallocate(batch);
+
+            //Each chunk compares its last key against the first of the next
+            bool has_duplicates = false;
+            try {
+                std::vector<char> duplicates(chunks, false);
+                impl::parallel_chunks(n - 1, chunks, [this, &duplicates] (std::size_t c, std::size_t lo, std::size_t hi) {
+                    for (std::size_t i = lo; i < hi; ++i) {
+                        if (!comparator(allocation.keys[i], allocation.keys[i + 1])) {
+                            duplicates[c] = true;
+                            return;
+                        }
+                    }
+                });
+
+                has_duplicates = std::find(duplicates.begin(), duplicates.end(), true) != duplicates.end();
+            } catch (...) {
+                clear();
+                throw;
+            }
+
+            if (has_duplicates) {
+                clear();
+                throw std::runtime_error("Duplicate keys passed to Array_map constructor.");
+            }
+
+            update_index();
         }
 
         template<class Zip_it>
@@ -245,6 +698,9 @@ namespace aul {
             base::operator=(rhs);
             comparator = rhs.comparator;
             elem_count = rhs.elem_count;
+            buffer_count = rhs.buffer_count;
+
+            update_index();
 
             return *this;
         }
@@ -262,27 +718,21 @@ namespace aul {
                 !aul::is_noexcept_movable_v<A> &&
                 base::operator!=(rhs);
 
-            if (use_new_allocation) {
-                Allocation new_allocation = allocate(rhs.elem_count);
-
-                move_elements(rhs.allocation, new_allocation, rhs.elem_count);
-                destroy_elements(rhs.allocation, rhs.elem_count);
-                rhs.deallocate(allocation);
+            clear();
 
-                elem_count = rhs.elem_count;
-                comparator = std::move(rhs.comparator);
-                allocation = std::move(rhs.allocation);
+            comparator = std::move(rhs.comparator);
+            search_index = std::move(rhs.search_index);
 
-                rhs.elem_count = 0;
+            if (use_new_allocation) {
+                allocation = allocate(rhs.elem_count);
+                move_elements(rhs.allocation, allocation, rhs.elem_count);
 
+                elem_count = rhs.elem_count;
+                buffer_count = rhs.buffer_count;
+                rhs.clear();
             } else {
                 base::operator=(rhs);
-
-                allocation = std::move(rhs.allocation);
-                comparator = rhs.comparator;
-                elem_count = rhs.elem_count;
-
-                rhs.elem_count = 0;
+                take_allocation(rhs);
             }
 
             return *this;
@@ -338,6 +788,23 @@ namespace aul {
                 return false;
             }
 
+            //Buffered elements may be split off differently so they're looked up
+            if (buffer_count || rhs.buffer_count) {
+                const key_pointer rhs_end = rhs.allocation.keys + rhs.elem_count;
+                for (size_type i = 0; i < elem_count; ++i) {
+                    const key_pointer ptr = rhs.search(allocation.keys[i]);
+                    if (ptr == rhs_end || !(*ptr == allocation.keys[i])) {
+                        return false;
+                    }
+
+                    if (!(rhs.allocation.vals[ptr - rhs.allocation.keys] == allocation.vals[i])) {
+                        return false;
+                    }
+                }
+
+                return true;
+            }
+
             return
                 std::equal(allocation.keys, allocation.keys + elem_count, rhs.allocation.keys) &&
                 std::equal(allocation.vals, allocation.vals + elem_count, rhs.allocation.vals);
@@ -347,13 +814,7 @@ namespace aul {
         /// \param rhs Array_map to compare against
         /// \return True if at least one key or element does not compare equal
         bool operator!=(const Array_map& rhs) const noexcept {
-            if (elem_count != rhs.elem_count) {
-                return true;
-            }
-
-            return
-                !std::equal(allocation.keys, allocation.keys + elem_count, rhs.allocation.keys) &&
-                !std::equal(allocation.vals, allocation.vals + elem_count, rhs.allocation.vals);
+            return !(*this == rhs);
         }
 
         //=================================================
@@ -362,7 +823,7 @@ namespace aul {
 
         [[nodiscard]]
         V& at(const key_type& key) {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = search(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -373,7 +834,7 @@ namespace aul {
 
         [[nodiscard]]
         const V& at(const key_type& key) const {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = search(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -384,7 +845,7 @@ namespace aul {
 
         [[nodiscard]]
         V& at(key_type&& key) {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = search(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -395,7 +856,7 @@ namespace aul {
 
         [[nodiscard]]
         const V& at(const key_type&& key) const {
-            const key_pointer pos = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer pos = search(key);
 
             if (!elem_count || !pos || pos == (allocation.keys + elem_count) || *pos != key) {
                 throw std::out_of_range("aul::Array_map::at() called with invalid key");
@@ -404,29 +865,63 @@ namespace aul {
             return allocation.vals[pos - allocation.keys];
         }
 
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \return Reference to element associated with key
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        V& at(const K2& key) {
+            const key_pointer pos = search(key);
+
+            if (!pos || pos == (allocation.keys + elem_count) || !compare_keys(*pos, key)) {
+                throw std::out_of_range("aul::Array_map::at() called with invalid key");
+            }
+
+            return allocation.vals[pos - allocation.keys];
+        }
+
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \return Reference to element associated with key
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        const V& at(const K2& key) const {
+            const key_pointer pos = search(key);
+
+            if (!pos || pos == (allocation.keys + elem_count) || !compare_keys(*pos, key)) {
+                throw std::out_of_range("aul::Array_map::at() called with invalid key");
+            }
+
+            return allocation.vals[pos - allocation.keys];
+        }
+
 
 
         [[nodiscard]]
         V& operator[](const key_type& key) noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = search(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         const V& operator[](const key_type& key) const noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = search(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         V& operator[](key_type&& key) noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = search(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
         [[nodiscard]]
         const V& operator[](key_type&& key) const noexcept {
-            const key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            const key_pointer key_ptr = search(key);
             return allocation.vals[key_ptr - allocation.keys];
         }
 
@@ -473,99 +968,8 @@ namespace aul {
         ///
         template<class...Args>
         std::pair<iterator, bool> emplace(const key_type& key, Args&&...args) {
-            if (size() > max_size() - 1) {
-                throw std::length_error("aul::Array_map grew too big");
-            }
-
-            //Check if element with key already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
-            if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                value_pointer ptr = allocation.vals + (key_ptr - allocation.keys);
-                return std::make_pair(iterator{key_ptr, ptr}, false);
-            }
-
-            if (size() + 1 <= capacity()) {
-                key_pointer keys_end = allocation.keys + elem_count;
-                value_pointer vals_end = allocation.vals + elem_count;
-
-                key_pointer new_key_ptr = key_ptr;
-                value_pointer new_val_ptr = allocation.vals + (new_key_ptr - allocation.keys);
-
-                //Move elements to open up space
-                if (new_key_ptr != keys_end) {
-                    //Move construct last element in each array
-                    construct_val(vals_end, std::move(vals_end[-1]));
-                    construct_key(keys_end, std::move(keys_end[-1]));
-
-                    //Move assign elements 1 slot to the right
-                    std::move_backward(new_key_ptr, keys_end - 1, keys_end);
-                    std::move_backward(new_val_ptr, vals_end - 1, vals_end);
-
-                    destroy_key(new_key_ptr);
-                    destroy_val(new_val_ptr);
-                }
-
-                try {
-                    construct_val(new_val_ptr, std::forward<Args>(args)...);
-                    construct_key(new_key_ptr, key);
-                } catch (...) {
-                    //Move keys and vals back to their original positions
-                    if (new_key_ptr != keys_end) {
-                        std::move(new_key_ptr + 1, keys_end + 1, new_key_ptr);
-                        std::move(new_val_ptr + 1, vals_end + 1, new_val_ptr);
-
-                        destroy_key(keys_end);
-                        destroy_val(vals_end);
-                    }
-                }
-
-                ++elem_count;
-                return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
-            } else {
-                Allocation new_allocation = allocate(grow_size(size() + 1));
-
-                key_pointer old_key_ptr = key_ptr;
-
-                key_pointer new_key_ptr = new_allocation.keys + (old_key_ptr - allocation.keys);
-                value_pointer new_val_ptr = new_allocation.vals + (old_key_ptr - allocation.keys);
-
-                //Try constructing value and key
-                try {
-                    construct_key(new_key_ptr, std::move(key));
-                } catch (...) {
-                    deallocate(new_allocation);
-                    throw;
-                }
-
-                try {
-                    construct_val(new_val_ptr, std::forward<Args>(args)...);
-                } catch (...) {
-                    destroy_key(new_key_ptr);
-                    deallocate(new_allocation);
-                    throw;
-                }
-
-                ///Move objects keys and vals to new allocation
-
-                auto val_alloc = get_allocator();
-                auto key_alloc = key_allocator_type{val_alloc};
-                aul::uninitialized_move(allocation.keys, old_key_ptr, new_allocation.keys, key_alloc);
-                aul::uninitialized_move(old_key_ptr, allocation.keys + size(), new_key_ptr + 1, key_alloc);
-
-                value_pointer old_val_ptr = allocation.vals + (old_key_ptr - allocation.keys);
-                aul::uninitialized_move(allocation.vals, old_val_ptr, new_allocation.vals, val_alloc);
-                aul::uninitialized_move(old_val_ptr, allocation.vals + size(), new_val_ptr + 1, val_alloc);
-
-                // Destroy old elements and allocation
-                destroy_elements(allocation, elem_count);
-                deallocate(allocation);
-
-                allocation = std::move(new_allocation);
-
-                ++elem_count;
-                return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
-            }
-        }
+            return emplace_impl(key, std::forward<Args>(args)...);
+        }
 
         ///
         /// Constructs element with an association with key
@@ -583,97 +987,31 @@ namespace aul {
         ///
         template<class...Args>
         std::pair<iterator, bool> emplace(key_type&& key, Args&&...args) {
-            if (size() > max_size() - 1) {
-                throw std::length_error("aul::Array_map grew too big");
-            }
-
-            //Check if element with key already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
-            if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                value_pointer val_ptr = allocation.vals + (key_ptr - allocation.keys);
-                return std::make_pair(iterator{key_ptr, val_ptr}, false);
-            }
-
-            if (size() + 1 <= capacity()) {
-                key_pointer keys_end = allocation.keys + elem_count;
-                value_pointer vals_end = allocation.vals + elem_count;
-
-                key_pointer new_key_ptr = key_ptr;
-                value_pointer new_val_ptr = allocation.vals + (new_key_ptr - allocation.keys);
-
-                //Move elements to new allocation
-                if (new_key_ptr != keys_end) {
-                    //Move construct last element in each array
-                    construct_key(keys_end, std::move(keys_end[-1]));
-                    construct_val(vals_end, std::move(vals_end[-1]));
-
-                    //Move assign elements 1 slot to the right
-                    std::move_backward(new_key_ptr, keys_end - 1, keys_end);
-                    std::move_backward(new_val_ptr, vals_end - 1, vals_end);
-
-                    destroy_key(new_key_ptr);
-                    destroy_val(new_val_ptr);
-                }
-
-                try {
-                    construct_val(new_val_ptr, std::forward<Args>(args)...);
-                    construct_key(new_key_ptr, key);
-                } catch (...) {
-                    //Move keys and vals back to their original positions
-                    if (new_key_ptr != keys_end) {
-                        std::move(new_key_ptr + 1, keys_end + 1, new_key_ptr);
-                        std::move(new_val_ptr + 1, vals_end + 1, new_val_ptr);
-
-                        destroy_key(keys_end);
-                        destroy_val(vals_end);
-                    }
-                }
-
-                ++elem_count;
-                return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
-            } else {
-                Allocation new_allocation = allocate(grow_size(size() + 1));
-
-                key_pointer old_key_ptr = key_ptr;
-
-                key_pointer new_key_ptr = new_allocation.keys + (old_key_ptr - allocation.keys);
-                value_pointer new_val_ptr = new_allocation.vals + (old_key_ptr - allocation.keys);
-
-                //Try constructing value and key
-                try {
-                    construct_key(new_key_ptr, std::move(key));
-                } catch (...) {
-                    deallocate(new_allocation);
-                    throw;
-                }
-
-                try {
-                    construct_val(new_val_ptr, std::forward<Args>(args)...);
-                } catch (...) {
-                    destroy_key(new_key_ptr);
-                    deallocate(new_allocation);
-                    throw;
-                }
-
-                // Move objects keys and vals to new allocation
-                auto val_alloc = get_allocator();
-                value_pointer old_val_ptr = allocation.vals + (old_key_ptr - allocation.keys);
-                aul::uninitialized_move(allocation.vals, old_val_ptr, new_allocation.vals, val_alloc);
-                aul::uninitialized_move(old_val_ptr, allocation.vals + size(), new_val_ptr + 1, val_alloc);
-
-                auto key_alloc = key_allocator_type{val_alloc};
-                aul::uninitialized_move(allocation.keys, old_key_ptr, new_allocation.keys, key_alloc);
-                aul::uninitialized_move(old_key_ptr, allocation.keys + size(), new_key_ptr + 1, key_alloc);
-
-                // Destroy old elements and allocation
-                destroy_elements(allocation, elem_count);
-                deallocate(allocation);
-
-                allocation = std::move(new_allocation);
+            return emplace_impl(std::move(key), std::forward<Args>(args)...);
+        }
 
-                ++elem_count;
-                return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
-            }
+        ///
+        /// Constructs element with an association with a key constructed
+        /// from key. Only available if the comparator is transparent.
+        ///
+        /// No key_type object is constructed unless an element is inserted,
+        /// so e.g. a map with std::string keys can be searched using a
+        /// std::string_view without allocating.
+        ///
+        /// \tparam K2 Type comparable with key_type from which key_type can
+        ///     be constructed
+        /// \tparam Args Argument types to value constructor
+        /// \param key Key to associate with new element
+        /// \param args Arguments to value constructor
+        /// \return Pair containing iterator to element and boolean indicating
+        ///     whether a new element was added
+        template<
+            class K2,
+            class...Args,
+            class = std::enable_if_t<is_transparent<K2>>
+        >
+        std::pair<iterator, bool> emplace(K2&& key, Args&&...args) {
+            return emplace_impl(std::forward<K2>(key), std::forward<Args>(args)...);
         }
 
         ///
@@ -693,8 +1031,10 @@ namespace aul {
                 throw std::length_error("aul::Array_map grew too big");
             }
 
+            flush();
+
             //Check if element already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = search(key);
             if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
                 value_pointer element_ptr = allocation.vals + (key_ptr - allocation.keys);
                 value_type temp{args...};
@@ -738,6 +1078,7 @@ namespace aul {
                 }
 
                 ++elem_count;
+                update_index();
                 return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
             } else {
                 Allocation new_allocation = allocate(grow_size(size() + 1));
@@ -780,6 +1121,7 @@ namespace aul {
                 allocation = std::move(new_allocation);
 
                 ++elem_count;
+                update_index();
                 return std::pair<iterator, bool>{iterator{new_key_ptr, new_val_ptr}, true};
             }
         }
@@ -804,8 +1146,10 @@ namespace aul {
                 throw std::length_error("aul::Array_map grew too big");
             }
 
+            flush();
+
             //Check if element already exists
-            key_pointer key_ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
+            key_pointer key_ptr = search(key);
             if (key_ptr && !empty() && compare_keys(*key_ptr, key)) {
                 value_pointer element_ptr = allocation.vals + (key_ptr - allocation.keys);
                 value_type temp{args...};
@@ -851,6 +1195,7 @@ namespace aul {
                 }
 
                 ++elem_count;
+                update_index();
                 return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
             } else {
                 //New allocation is necessary
@@ -896,110 +1241,468 @@ namespace aul {
                 allocation = std::move(new_allocation);
 
                 ++elem_count;
+                update_index();
                 return std::make_pair(iterator{new_key_ptr, new_val_ptr}, true);
             }
 
         }
 
-        //=================================================
-        // Erasure methods
-        //=================================================
-
         ///
-        /// \param pos Valid iterator to element
-        /// \return Iterator to element which replaced the removed element
-        iterator erase(iterator pos) noexcept {
-            key_pointer key_ptr = get<0>(pos);
-            value_pointer val_ptr = get<1>(pos);
+        /// Inserts all key-value pairs in the specified range. Pairs whose key
+        /// is already present, or which repeat the key of an earlier pair in
+        /// the range, are not inserted.
+        ///
+        /// Rather than inserting pairs one at a time, the batch is sorted and
+        /// then merged with the existing elements in a single linear pass,
+        /// working backwards from the end of the arrays when the current
+        /// allocation suffices, so that no element is moved more than once.
+        ///
+        /// If the range is an rvalue, keys and values are moved out of it.
+        ///
+        /// Keys and values must be nothrow move constructible and assignable,
+        /// since the merge moves existing elements and cannot undo a
+        /// partially completed pass.
+        ///
+        /// \tparam R Range type whose elements are tuple-like key-value pairs
+        /// \param range Range of key-value pairs to insert
+        /// \return Number of elements which were inserted
+        template<class R>
+        size_type insert(R&& range) {
+            using std::begin;
+            using std::end;
+            using std::get;
 
-            std::move(key_ptr + 1, allocation.keys + elem_count, key_ptr);
-            std::move(val_ptr + 1, allocation.vals + elem_count, val_ptr);
+            const auto n = static_cast<size_type>(std::distance(begin(range), end(range)));
+            if (!n) {
+                return 0;
+            }
 
-            destroy_key(key_ptr + elem_count - 1);
-            destroy_val(val_ptr + elem_count - 1);
+            flush();
 
-            --elem_count;
-            return pos;
-        }
+            //Kept on the heap so the inline buffer remains free for the result
+            auto batch_allocator = get_allocator();
+            Allocation batch = allocate(batch_allocator, n);
 
-        ///
-        /// \param key Key mapping to element to erase
-        /// \return Iterator to element which replaced the removed element.
-        ///     Equal to end() if did not exist
-        iterator erase(const key_type& key) noexcept {
-            auto it = find(key);
+            size_type constructed = 0;
+            try {
+                for (auto&& pair : range) {
+                    if constexpr (std::is_rvalue_reference<R&&>::value) {
+                        construct_key(batch.keys + constructed, get<0>(std::move(pair)));
+                        try {
+                            construct_val(batch.vals + constructed, get<1>(std::move(pair)));
+                        } catch (...) {
+                            destroy_key(batch.keys + constructed);
+                            throw;
+                        }
+                    } else {
+                        construct_key(batch.keys + constructed, get<0>(pair));
+                        try {
+                            construct_val(batch.vals + constructed, get<1>(pair));
+                        } catch (...) {
+                            destroy_key(batch.keys + constructed);
+                            throw;
+                        }
+                    }
 
-            const iterator e = end();
-            if (it == e) {
-                return e;
+                    ++constructed;
+                }
+            } catch (...) {
+                destroy_elements(batch, constructed);
+                deallocate(batch);
+                throw;
             }
-            return erase(it);
-        }
 
-        //=================================================
-        // Inspection functions
-        //=================================================
+            size_type ret = 0;
+            try {
+                //Stable so that the first of several pairs with equal keys wins
+                index_vector order(n, index_allocator_type{get_allocator()});
+                std::iota(order.begin(), order.end(), size_type{0});
+                std::stable_sort(order.begin(), order.end(), [this, &batch] (size_type a, size_type b) {
+                    return comparator(batch.keys[a], batch.keys[b]);
+                });
+
+                ret = merge_batch(batch, order);
+            } catch (...) {
+                destroy_elements(batch, n);
+                deallocate(batch);
+                throw;
+            }
 
-        ///
-        /// \param key Key to search for
-        /// \return Iterator to element corresponding to key. end() if no such
-        ///     element exists
-        [[nodiscard]]
-        iterator find(const key_type& key) noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            destroy_elements(batch, n);
+            deallocate(batch);
 
-            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
-            } else {
-                return end();
-            }
+            return ret;
         }
 
         ///
-        /// \param key Key to search for
-        /// \return Iterator to element. end() if not found
-        [[nodiscard]]
-        const_iterator find(const key_type& key) const noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
-
-            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
-            } else {
-                return cend();
+        /// Moves all elements out of other whose keys are not present in
+        /// this Array_map in a single linear merge. Elements of other whose
+        /// keys are already present are destroyed. other is left empty.
+        ///
+        /// other must order its keys the same way as this object. Keys and
+        /// values must be nothrow move constructible and assignable.
+        ///
+        /// \param other Array_map to merge into this one
+        /// \return Number of elements which were inserted
+        size_type merge(Array_map&& other) {
+            if (this == &other || other.empty()) {
+                return 0;
             }
-        }
 
-        template<class K2>
-        [[nodiscard]]
-        iterator find(const K2& key) noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            flush();
+            other.flush();
 
-            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
-            } else {
-                return end();
-            }
-        }
+            index_vector order(other.elem_count, index_allocator_type{get_allocator()});
+            std::iota(order.begin(), order.end(), size_type{0});
 
-        template<class K2>
-        [[nodiscard]]
-        const_iterator find(const K2& key) const noexcept {
-            key_pointer key_ptr = {aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator)};
+            const size_type ret = merge_batch(other.allocation, order);
+            other.clear();
 
-            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
-                return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
-            } else {
-                return cend();
-            }
+            return ret;
         }
 
         ///
-        /// \param key Key to search for
+        /// Attempts to construct a new element in the insertion buffer, a
+        /// second sorted run of elements kept at the back of the arrays.
+        /// Only elements of the buffer need to be shifted to make room for
+        /// the new element, so inserting keys which arrive roughly in order,
+        /// or which cluster together, is cheap regardless of the size of the
+        /// Array_map.
+        ///
+        /// Lookups search both runs, so remain logarithmic. Iteration, keys(),
+        /// and values() visit buffered elements after all other elements
+        /// until the buffer is merged into the main run by flush(). This
+        /// happens automatically once buffered() reaches buffer_limit(), and
+        /// before any other insertion.
+        ///
+        /// If key or any argument in args references the current content of
+        /// the container, the behavior is undefined.
+        ///
+        /// Requires keys and values to be nothrow move constructible and
+        /// assignable, since flush() relies on this to provide its exception
+        /// guarantee.
+        ///
+        /// \tparam K2 Key type
+        /// \tparam Args Argument types to value constructor
+        /// \param key Key to associate with new element
+        /// \param args Arguments to value constructor
+        /// \return Pair containing iterator to element and boolean indicating
+        ///     whether a new element was added
+        template<
+            class K2,
+            class...Args,
+            class = std::enable_if_t<is_key_like<std::decay_t<K2>>>
+        >
+        std::pair<iterator, bool> emplace_buffered(K2&& key, Args&&...args) {
+            static_assert(
+                std::is_nothrow_move_constructible<key_type>::value && std::is_nothrow_move_assignable<key_type>::value &&
+                std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value,
+                "aul::Array_map buffered insertion requires nothrow movable keys and values"
+            );
+
+            if (size() > max_size() - 1) {
+                throw std::length_error("aul::Array_map grew too big");
+            }
+
+            if (buffer_count >= buffer_limit()) {
+                flush();
+            }
+
+            //Check if element with key already exists
+            key_pointer key_ptr = search(key);
+            if (key_ptr != allocation.keys + elem_count && compare_keys(*key_ptr, key)) {
+                value_pointer ptr = allocation.vals + (key_ptr - allocation.keys);
+                return std::make_pair(iterator{key_ptr, ptr}, false);
+            }
+
+            key_ptr = aul::binary_search(allocation.keys + (elem_count - buffer_count), allocation.keys + elem_count, key, comparator);
+
+            iterator ret = insert_at(key_ptr, std::forward<K2>(key), std::forward<Args>(args)...);
+            ++buffer_count;
+            return std::make_pair(ret, true);
+        }
+
+        ///
+        /// Merges all elements in the insertion buffer into the main run of
+        /// elements. Only elements of the main run which compare greater than
+        /// the least buffered key are moved.
+        ///
+        /// Provides the strong exception guarantee. Only allocation may throw,
+        /// as elements can only have been buffered if their keys and values
+        /// are nothrow movable
+        ///
+        void flush() {
+            if (!buffer_count) {
+                return;
+            }
+
+            const size_type n = buffer_count;
+            const size_type main_count = elem_count - n;
+
+            auto batch_allocator = get_allocator();
+            Allocation batch = allocate(batch_allocator, n);
+
+            index_vector order{index_allocator_type{get_allocator()}};
+            try {
+                order.resize(n);
+            } catch (...) {
+                deallocate(batch);
+                throw;
+            }
+            std::iota(order.begin(), order.end(), size_type{0});
+
+            auto val_alloc = get_allocator();
+            auto key_alloc = key_allocator_type{val_alloc};
+
+            aul::uninitialized_move_n(allocation.keys + main_count, n, batch.keys, key_alloc);
+            aul::uninitialized_move_n(allocation.vals + main_count, n, batch.vals, val_alloc);
+
+            aul::destroy_n(allocation.keys + main_count, n, key_alloc);
+            aul::destroy_n(allocation.vals + main_count, n, val_alloc);
+
+            elem_count = main_count;
+            buffer_count = 0;
+
+            merge_backwards(batch, order.data(), n);
+            elem_count += n;
+
+            destroy_elements(batch, n);
+            deallocate(batch);
+
+            update_index();
+        }
+
+        ///
+        /// \return Number of elements in the insertion buffer
+        [[nodiscard]]
+        size_type buffered() const noexcept {
+            return buffer_count;
+        }
+
+        ///
+        /// \return Number of elements the insertion buffer may hold before
+        ///     emplace_buffered() flushes it. Grows with the square root of
+        ///     size() so that the cost of flushing is amortized
+        [[nodiscard]]
+        size_type buffer_limit() const noexcept {
+            constexpr size_type min_limit = 32;
+            const auto root = static_cast<size_type>(std::sqrt(static_cast<double>(elem_count - buffer_count)));
+            return std::max(min_limit, root);
+        }
+
+        //=================================================
+        // Erasure methods
+        //=================================================
+
+        ///
+        /// \param pos Valid iterator to element
+        /// \return Iterator to element which replaced the removed element
+        iterator erase(iterator pos) noexcept {
+            key_pointer key_ptr = get<0>(pos);
+            value_pointer val_ptr = get<1>(pos);
+
+            const bool is_buffered = key_ptr >= allocation.keys + (elem_count - buffer_count);
+
+            std::move(key_ptr + 1, allocation.keys + elem_count, key_ptr);
+            std::move(val_ptr + 1, allocation.vals + elem_count, val_ptr);
+
+            destroy_key(allocation.keys + elem_count - 1);
+            destroy_val(allocation.vals + elem_count - 1);
+
+            --elem_count;
+            if (is_buffered) {
+                --buffer_count;
+            } else {
+                update_index();
+            }
+
+            return pos;
+        }
+
+        ///
+        /// \param key Key mapping to element to erase
+        /// \return Iterator to element which replaced the removed element.
+        ///     Equal to end() if did not exist
+        iterator erase(const key_type& key) noexcept {
+            auto it = find(key);
+
+            const iterator e = end();
+            if (it == e) {
+                return e;
+            }
+            return erase(it);
+        }
+
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \return Iterator to element which replaced the removed element.
+        ///     Equal to end() if did not exist
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        iterator erase(const K2& key) noexcept {
+            auto it = find(key);
+
+            const iterator e = end();
+            if (it == e) {
+                return e;
+            }
+            return erase(it);
+        }
+
+        //=================================================
+        // Inspection functions
+        //=================================================
+
+        ///
+        /// \param key Key to search for
+        /// \return Iterator to element corresponding to key. end() if no such
+        ///     element exists
+        [[nodiscard]]
+        iterator find(const key_type& key) noexcept {
+            key_pointer key_ptr = search(key);
+
+            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
+                return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
+            } else {
+                return end();
+            }
+        }
+
+        ///
+        /// \param key Key to search for
+        /// \return Iterator to element. end() if not found
+        [[nodiscard]]
+        const_iterator find(const key_type& key) const noexcept {
+            key_pointer key_ptr = search(key);
+
+            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
+                return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
+            } else {
+                return cend();
+            }
+        }
+
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \return Iterator to element corresponding to key. end() if no such
+        ///     element exists
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        iterator find(const K2& key) noexcept {
+            key_pointer key_ptr = search(key);
+
+            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
+                return iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
+            } else {
+                return end();
+            }
+        }
+
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \return Iterator to element. end() if not found
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        const_iterator find(const K2& key) const noexcept {
+            key_pointer key_ptr = search(key);
+
+            if (key_ptr && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
+                return const_iterator{key_ptr, allocation.vals + (key_ptr - allocation.keys)};
+            } else {
+                return cend();
+            }
+        }
+
+        ///
+        /// Looks up each of the specified keys, writing an iterator to the
+        /// element it maps to, or end() if there is none, to out.
+        ///
+        /// Since the queries are sorted, each search gallops forward from
+        /// where the previous one ended rather than restarting from the
+        /// whole key array, so m queries against n keys take
+        /// O(m log(n / m)) comparisons. Buffered elements are searched with a
+        /// second cursor of their own.
+        ///
+        /// \tparam Out Output iterator type accepting iterator objects
+        /// \param sorted_queries Keys to search for, sorted according to the
+        ///     comparator
+        /// \param out Output iterator to write results to
+        /// \return Output iterator past the last result written
+        template<class Out>
+        Out find_many(aul::Span<const key_type> sorted_queries, Out out) {
+            const key_pointer keys_end = allocation.keys + elem_count;
+
+            key_pointer main_pos = allocation.keys;
+            key_pointer buffer_pos = allocation.keys + (elem_count - buffer_count);
+            for (const key_type& query : sorted_queries) {
+                key_pointer pos = gallop(main_pos, buffer_pos, query);
+
+                if (pos != keys_end) {
+                    *out = iterator{pos, allocation.vals + (pos - allocation.keys)};
+                } else {
+                    *out = end();
+                }
+
+                ++out;
+            }
+
+            return out;
+        }
+
+        ///
+        /// Looks up each of the specified keys, writing an iterator to the
+        /// element it maps to, or end() if there is none, to out.
+        ///
+        /// \tparam Out Output iterator type accepting const_iterator objects
+        /// \param sorted_queries Keys to search for, sorted according to the
+        ///     comparator
+        /// \param out Output iterator to write results to
+        /// \return Output iterator past the last result written
+        template<class Out>
+        Out find_many(aul::Span<const key_type> sorted_queries, Out out) const {
+            const key_pointer keys_end = allocation.keys + elem_count;
+
+            key_pointer main_pos = allocation.keys;
+            key_pointer buffer_pos = allocation.keys + (elem_count - buffer_count);
+            for (const key_type& query : sorted_queries) {
+                key_pointer pos = gallop(main_pos, buffer_pos, query);
+
+                if (pos != keys_end) {
+                    *out = const_iterator{pos, allocation.vals + (pos - allocation.keys)};
+                } else {
+                    *out = cend();
+                }
+
+                ++out;
+            }
+
+            return out;
+        }
+
+        ///
+        /// \param key Key to search for
         /// \returns True if key maps to an element
         [[nodiscard]]
         bool contains(const key_type& key) const noexcept {
-            key_pointer ptr = aul::binary_search(allocation.keys, allocation.keys + elem_count, key, comparator);
-            return (ptr && size() && compare_keys(*ptr, key));
+            key_pointer ptr = search(key);
+            return (ptr && (ptr != allocation.keys + elem_count) && compare_keys(*ptr, key));
+        }
+
+        ///
+        /// Only available if the comparator is transparent
+        ///
+        /// \param key Object comparable with keys
+        /// \returns True if key maps to an element
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        bool contains(const K2& key) const noexcept {
+            key_pointer ptr = search(key);
+            return (ptr && (ptr != allocation.keys + elem_count) && compare_keys(*ptr, key));
         }
 
         [[nodiscard]]
@@ -1022,6 +1725,189 @@ namespace aul {
             }
         }
 
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        V& get_or_default(const K2& key, V& def) noexcept {
+            auto it = find(key);
+            if (it == end()) {
+                return def;
+            } else {
+                return std::get<1>(*it);
+            }
+        }
+
+        template<class K2, class = std::enable_if_t<is_transparent<K2>>>
+        [[nodiscard]]
+        const V& get_or_default(const K2& key, const V& def) noexcept {
+            auto it = find(key);
+            if (it == end()) {
+                return def;
+            } else {
+                return std::get<1>(*it);
+            }
+        }
+
+        //=================================================
+        // Range queries
+        //=================================================
+
+        ///
+        /// The returned slices are views directly over the key and value
+        /// arrays, so they remain valid until the next insertion or erasure.
+        /// Any buffered elements are first merged into the main run
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slice over all elements whose keys are not less than key
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        aul::Multispan<const key_type, value_type> lower_bound(const K2& key) {
+            flush();
+            return slice(search(as_key(key)), allocation.keys + elem_count);
+        }
+
+        ///
+        /// Const counterpart to lower_bound(). Elements added by
+        /// emplace_buffered() which have not been flushed are kept in a second
+        /// sorted run, which a const query cannot merge into the first. The
+        /// result therefore holds one slice per run. The second is empty if no
+        /// elements are buffered.
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slices over all elements in each run whose keys are not
+        ///     less than key
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        std::pair<aul::Multispan<const key_type, const value_type>, aul::Multispan<const key_type, const value_type>> lower_bound_runs(const K2& key) const {
+            if (!buffer_count) {
+                return {slice(search(as_key(key)), allocation.keys + elem_count), {}};
+            }
+
+            const auto& k = as_key(key);
+            return slices_per_run([this, &k] (key_pointer first, key_pointer last) {
+                return std::make_pair(std::lower_bound(first, last, k, comparator), last);
+            });
+        }
+
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slice over all elements whose keys are greater than key
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        aul::Multispan<const key_type, value_type> upper_bound(const K2& key) {
+            flush();
+            return slice(search_upper(as_key(key)), allocation.keys + elem_count);
+        }
+
+        ///
+        /// Const counterpart to upper_bound(). Holds one slice per sorted run, as
+        /// described for lower_bound_runs()
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slices over all elements in each run whose keys are greater
+        ///     than key
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        std::pair<aul::Multispan<const key_type, const value_type>, aul::Multispan<const key_type, const value_type>> upper_bound_runs(const K2& key) const {
+            if (!buffer_count) {
+                return {slice(search_upper(as_key(key)), allocation.keys + elem_count), {}};
+            }
+
+            const auto& k = as_key(key);
+            return slices_per_run([this, &k] (key_pointer first, key_pointer last) {
+                return std::make_pair(std::upper_bound(first, last, k, comparator), last);
+            });
+        }
+
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slice over the element whose key is equivalent to key.
+        ///     Empty if there is no such element
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        aul::Multispan<const key_type, value_type> equal_range(const K2& key) {
+            flush();
+            const auto& k = as_key(key);
+            return slice(search(k), search_upper(k));
+        }
+
+        ///
+        /// Const counterpart to equal_range(). Holds one slice per sorted run, as
+        /// described for lower_bound_runs()
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param key Key to compare against
+        /// \return Slices over the element whose key is equivalent to key.
+        ///     Both are empty if there is no such element
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        std::pair<aul::Multispan<const key_type, const value_type>, aul::Multispan<const key_type, const value_type>> equal_range_runs(const K2& key) const {
+            const auto& k = as_key(key);
+            if (!buffer_count) {
+                return {slice(search(k), search_upper(k)), {}};
+            }
+
+            return slices_per_run([this, &k] (key_pointer first, key_pointer last) {
+                return std::equal_range(first, last, k, comparator);
+            });
+        }
+
+        ///
+        /// Intended for window queries, e.g. over timestamps, where the
+        /// elements in the returned slice may be aggregated directly over
+        /// contiguous memory
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param lo Inclusive lower bound on keys
+        /// \param hi Exclusive upper bound on keys
+        /// \return Slice over all elements whose keys are not less than lo
+        ///     and are less than hi. Empty if hi is not greater than lo
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        aul::Multispan<const key_type, value_type> range(const K2& lo, const K2& hi) {
+            flush();
+            key_pointer first = search(as_key(lo));
+            return slice(first, std::max(first, search(as_key(hi))));
+        }
+
+        ///
+        /// Const counterpart to range(). Holds one slice per sorted run, as
+        /// described for lower_bound_runs()
+        ///
+        /// \tparam K2 Key type. Converted to key_type unless comparator is
+        ///     transparent
+        /// \param lo Inclusive lower bound on keys
+        /// \param hi Exclusive upper bound on keys
+        /// \return Slices over all elements in each run whose keys are not less
+        ///     than lo and are less than hi. Both are empty if hi is not
+        ///     greater than lo
+        template<class K2, class = std::enable_if_t<is_key_like<K2>>>
+        [[nodiscard]]
+        std::pair<aul::Multispan<const key_type, const value_type>, aul::Multispan<const key_type, const value_type>> range_runs(const K2& lo, const K2& hi) const {
+            if (!buffer_count) {
+                key_pointer first = search(as_key(lo));
+                return {slice(first, std::max(first, search(as_key(hi)))), {}};
+            }
+
+            const auto& l = as_key(lo);
+            const auto& h = as_key(hi);
+            return slices_per_run([this, &l, &h] (key_pointer first, key_pointer last) {
+                const key_pointer a = std::lower_bound(first, last, l, comparator);
+                return std::make_pair(a, std::max(a, std::lower_bound(first, last, h, comparator)));
+            });
+        }
+
         //=================================================
         // Misc. methods
         //=================================================
@@ -1030,10 +1916,22 @@ namespace aul {
         /// \param rhs Array_map to swap contents with
         ///
         void swap(Array_map& rhs) noexcept(aul::is_noexcept_swappable_v<A>) {
+            //Inline buffers cannot be exchanged so their contents are moved
+            if constexpr (N != 0) {
+                if (is_small() || rhs.is_small()) {
+                    Array_map temp{std::move(rhs)};
+                    rhs = std::move(*this);
+                    *this = std::move(temp);
+                    return;
+                }
+            }
+
             base::swap(rhs);
             std::swap(elem_count, rhs.elem_count);
+            std::swap(buffer_count, rhs.buffer_count);
             std::swap(allocation, rhs.allocation);
             std::swap(comparator, rhs.comparator);
+            std::swap(search_index, rhs.search_index);
         }
 
         friend void swap(Array_map& lhs, Array_map& rhs) noexcept(noexcept(lhs.swap(rhs))) {
@@ -1096,7 +1994,9 @@ namespace aul {
             aul::destroy_n(allocation.keys, elem_count, key_alloc);
 
             elem_count = 0;
+            buffer_count = 0;
             deallocate(allocation);
+            search_index.clear();
         }
 
         ///
@@ -1104,7 +2004,7 @@ namespace aul {
         ///
         /// \param n Number to increase capacity to
         void reserve(const size_type n) {
-            if (n <= elem_count) {
+            if (n <= capacity()) {
                 return;
             }
 
@@ -1115,6 +2015,9 @@ namespace aul {
             Allocation new_allocation = allocate(n);
             move_elements(allocation, new_allocation, elem_count);
 
+            destroy_elements(allocation, elem_count);
+            deallocate(allocation);
+
             allocation = std::move(new_allocation);
         }
 
@@ -1217,11 +2120,36 @@ namespace aul {
         key_compare comparator{};
         size_type   elem_count{};
 
+        ///
+        /// Number of elements at the back of the arrays which were added by
+        /// emplace_buffered() and form a second sorted run
+        ///
+        size_type   buffer_count{};
+
+        Array_map_index<L, K, A> search_index{};
+
         //=================================================
         // (de)allocation helper functions
         //=================================================
 
+        ///
+        /// Uses the inline buffer if it is large enough and not in use
+        ///
+        /// \param n Size of allocation
+        /// \return Allocation of size n
+        [[nodiscard]]
         Allocation allocate(const size_type n) {
+            if constexpr (N != 0) {
+                if (n <= N && !is_small()) {
+                    Allocation ret{};
+                    ret.keys = small_keys();
+                    ret.vals = small_vals();
+                    ret.capacity = N;
+
+                    return ret;
+                }
+            }
+
             auto allocator = get_allocator();
             return allocate(allocator, n);
         }
@@ -1270,6 +2198,13 @@ namespace aul {
         }
 
         void deallocate(Allocation& a) noexcept {
+            if constexpr (N != 0) {
+                if (a.keys == small_keys()) {
+                    a = Allocation{};
+                    return;
+                }
+            }
+
             auto val_alloc = get_allocator();
             auto key_alloc = key_allocator_type{};
             std::allocator_traits<value_allocator_type>::deallocate(val_alloc, a.vals, a.capacity);
@@ -1279,14 +2214,69 @@ namespace aul {
         }
 
         ///
-        /// \param alloc Allocation to free. Empty after successful completion
+        /// \param alloc Allocation to free. Empty after successful completion
+        ///
+        static void deallocate(value_allocator_type& val_alloc, Allocation& allocation) noexcept {
+            auto key_alloc = key_allocator_type{val_alloc};
+            std::allocator_traits<value_allocator_type>::deallocate(val_alloc, allocation.vals, allocation.capacity);
+            std::allocator_traits<key_allocator_type>::deallocate(key_alloc, allocation.keys, allocation.capacity);
+
+            allocation = Allocation{};
+        }
+
+        //=================================================
+        // Small buffer helper functions
+        //=================================================
+
+        ///
+        /// \return Pointer to key array within inline buffer
+        [[nodiscard]]
+        key_pointer small_keys() noexcept {
+            static_assert(N == 0 || std::is_pointer<key_pointer>::value, "Inline storage requires an allocator with raw pointers");
+            return reinterpret_cast<key_pointer>(small_buffer_base::small_buffer());
+        }
+
+        ///
+        /// \return Pointer to value array within inline buffer
+        [[nodiscard]]
+        value_pointer small_vals() noexcept {
+            static_assert(N == 0 || std::is_pointer<value_pointer>::value, "Inline storage requires an allocator with raw pointers");
+            return reinterpret_cast<value_pointer>(small_buffer_base::small_buffer() + impl::array_map_small_vals_offset<K, V, N>());
+        }
+
+        ///
+        /// \return True if the current allocation is the inline buffer
+        [[nodiscard]]
+        bool is_small() noexcept {
+            if constexpr (N != 0) {
+                return allocation.keys == small_keys();
+            } else {
+                return false;
+            }
+        }
+
+        ///
+        /// Takes ownership of other's elements, moving them individually if
+        /// they are stored in other's inline buffer. Current allocation must
+        /// be empty. other is left empty.
         ///
-        static void deallocate(value_allocator_type& val_alloc, Allocation& allocation) noexcept {
-            auto key_alloc = key_allocator_type{val_alloc};
-            std::allocator_traits<value_allocator_type>::deallocate(val_alloc, allocation.vals, allocation.capacity);
-            std::allocator_traits<key_allocator_type>::deallocate(key_alloc, allocation.keys, allocation.capacity);
+        /// \param other Array_map to take elements from
+        void take_allocation(Array_map& other) noexcept {
+            if constexpr (N != 0) {
+                if (other.is_small()) {
+                    allocation = allocate(other.allocation.capacity);
+                    move_elements(other.allocation, allocation, other.elem_count);
+                    elem_count = other.elem_count;
+                    buffer_count = other.buffer_count;
 
-            allocation = Allocation{};
+                    other.clear();
+                    return;
+                }
+            }
+
+            allocation = std::move(other.allocation);
+            elem_count = std::exchange(other.elem_count, 0);
+            buffer_count = std::exchange(other.buffer_count, 0);
         }
 
         //=================================================
@@ -1365,6 +2355,459 @@ namespace aul {
             aul::destroy_n(source.keys, n, key_alloc);
         }
 
+        //=================================================
+        // Emplacement helper functions
+        //=================================================
+
+        ///
+        /// Implementation of emplace() for all key types. The key is only
+        /// used to construct a key_type object once it is known that an
+        /// element will be inserted
+        ///
+        /// \tparam K2 Key type
+        /// \tparam Args Argument types to value constructor
+        /// \param key Key to associate with new element
+        /// \param args Arguments to value constructor
+        /// \return Pair containing iterator to element and boolean indicating
+        ///     whether a new element was added
+        template<class K2, class...Args>
+        std::pair<iterator, bool> emplace_impl(K2&& key, Args&&...args) {
+            if (size() > max_size() - 1) {
+                throw std::length_error("aul::Array_map grew too big");
+            }
+
+            flush();
+
+            //Check if element with key already exists
+            key_pointer key_ptr = search(key);
+            if (key_ptr && !empty() && (key_ptr != allocation.keys + elem_count) && compare_keys(*key_ptr, key)) {
+                value_pointer ptr = allocation.vals + (key_ptr - allocation.keys);
+                return std::make_pair(iterator{key_ptr, ptr}, false);
+            }
+
+            iterator ret = insert_at(key_ptr, std::forward<K2>(key), std::forward<Args>(args)...);
+            update_index();
+            return std::make_pair(ret, true);
+        }
+
+        ///
+        /// Constructs a new element at the specified position, shifting the
+        /// elements after it back by one slot, and reallocating if the
+        /// current allocation does not suffice. Does not update the search
+        /// index
+        ///
+        /// \tparam K2 Key type
+        /// \tparam Args Argument types to value constructor
+        /// \param key_ptr Pointer into key array at which to insert
+        /// \param key Key to associate with new element
+        /// \param args Arguments to value constructor
+        /// \return Iterator to new element
+        template<class K2, class...Args>
+        iterator insert_at(key_pointer key_ptr, K2&& key, Args&&...args) {
+            if (size() + 1 <= capacity()) {
+                key_pointer keys_end = allocation.keys + elem_count;
+                value_pointer vals_end = allocation.vals + elem_count;
+
+                key_pointer new_key_ptr = key_ptr;
+                value_pointer new_val_ptr = allocation.vals + (new_key_ptr - allocation.keys);
+
+                //Move elements to open up space
+                if (new_key_ptr != keys_end) {
+                    //Move construct last element in each array
+                    construct_val(vals_end, std::move(vals_end[-1]));
+                    construct_key(keys_end, std::move(keys_end[-1]));
+
+                    //Move assign elements 1 slot to the right
+                    std::move_backward(new_key_ptr, keys_end - 1, keys_end);
+                    std::move_backward(new_val_ptr, vals_end - 1, vals_end);
+
+                    destroy_key(new_key_ptr);
+                    destroy_val(new_val_ptr);
+                }
+
+                try {
+                    construct_val(new_val_ptr, std::forward<Args>(args)...);
+                    construct_key(new_key_ptr, std::forward<K2>(key));
+                } catch (...) {
+                    //Move keys and vals back to their original positions
+                    if (new_key_ptr != keys_end) {
+                        std::move(new_key_ptr + 1, keys_end + 1, new_key_ptr);
+                        std::move(new_val_ptr + 1, vals_end + 1, new_val_ptr);
+
+                        destroy_key(keys_end);
+                        destroy_val(vals_end);
+                    }
+
+                    throw;
+                }
+
+                ++elem_count;
+                return iterator{new_key_ptr, new_val_ptr};
+            } else {
+                Allocation new_allocation = allocate(grow_size(size() + 1));
+
+                key_pointer old_key_ptr = key_ptr;
+
+                key_pointer new_key_ptr = new_allocation.keys + (old_key_ptr - allocation.keys);
+                value_pointer new_val_ptr = new_allocation.vals + (old_key_ptr - allocation.keys);
+
+                //Try constructing value and key
+                try {
+                    construct_key(new_key_ptr, std::forward<K2>(key));
+                } catch (...) {
+                    deallocate(new_allocation);
+                    throw;
+                }
+
+                try {
+                    construct_val(new_val_ptr, std::forward<Args>(args)...);
+                } catch (...) {
+                    destroy_key(new_key_ptr);
+                    deallocate(new_allocation);
+                    throw;
+                }
+
+                ///Move objects keys and vals to new allocation
+
+                auto val_alloc = get_allocator();
+                auto key_alloc = key_allocator_type{val_alloc};
+                aul::uninitialized_move(allocation.keys, old_key_ptr, new_allocation.keys, key_alloc);
+                aul::uninitialized_move(old_key_ptr, allocation.keys + size(), new_key_ptr + 1, key_alloc);
+
+                value_pointer old_val_ptr = allocation.vals + (old_key_ptr - allocation.keys);
+                aul::uninitialized_move(allocation.vals, old_val_ptr, new_allocation.vals, val_alloc);
+                aul::uninitialized_move(old_val_ptr, allocation.vals + size(), new_val_ptr + 1, val_alloc);
+
+                // Destroy old elements and allocation
+                destroy_elements(allocation, elem_count);
+                deallocate(allocation);
+
+                allocation = std::move(new_allocation);
+
+                ++elem_count;
+                return iterator{new_key_ptr, new_val_ptr};
+            }
+        }
+
+        //=================================================
+        // Merge helper functions
+        //=================================================
+
+        using index_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<size_type>;
+        using index_vector = std::vector<size_type, index_allocator_type>;
+
+        ///
+        /// Fewest elements worth handing to a thread of their own during
+        /// parallel construction
+        ///
+        static constexpr std::size_t min_parallel_chunk = 1 << 14;
+
+        ///
+        /// Moves elements from batch into this object's arrays, leaving them
+        /// in a moved-from state. Elements in batch whose keys repeat an
+        /// earlier key in order, or are already present, are skipped.
+        ///
+        /// \param batch Allocation containing elements to merge
+        /// \param order Indices into batch, in ascending order of key.
+        ///     Overwritten with the indices of the merged elements
+        /// \return Number of elements merged
+        size_type merge_batch(Allocation& batch, index_vector& order) {
+            static_assert(
+                std::is_nothrow_move_constructible<key_type>::value && std::is_nothrow_move_assignable<key_type>::value &&
+                std::is_nothrow_move_constructible<value_type>::value && std::is_nothrow_move_assignable<value_type>::value,
+                "aul::Array_map bulk insertion and merge require nothrow movable keys and values"
+            );
+
+            //Filter out repeated and already present keys in a forward pass
+            size_type selected = 0;
+
+            key_pointer existing = allocation.keys;
+            const key_pointer existing_end = allocation.keys + elem_count;
+
+            const key_type* previous = nullptr;
+            for (size_type i = 0; i < order.size(); ++i) {
+                const key_type& key = batch.keys[order[i]];
+                const bool is_repeat = previous && !comparator(*previous, key);
+                previous = &key;
+
+                if (is_repeat) {
+                    continue;
+                }
+
+                while (existing != existing_end && comparator(*existing, key)) {
+                    ++existing;
+                }
+
+                if (existing != existing_end && !comparator(key, *existing)) {
+                    continue;
+                }
+
+                order[selected++] = order[i];
+            }
+
+            if (!selected) {
+                return 0;
+            }
+
+            if (max_size() - elem_count < selected) {
+                throw std::length_error("aul::Array_map grew too big");
+            }
+
+            const size_type total = elem_count + selected;
+            if (total <= capacity()) {
+                merge_backwards(batch, order.data(), selected);
+            } else {
+                merge_into_new_allocation(batch, order.data(), selected, grow_size(total));
+            }
+
+            elem_count = total;
+            update_index();
+
+            return selected;
+        }
+
+        ///
+        /// Merges elements into the current allocation, which must have room
+        /// for them, by filling it from the back. Elements of the current
+        /// allocation are each moved at most once
+        ///
+        /// \param batch Allocation containing elements to merge
+        /// \param order Indices into batch of elements to merge in ascending
+        ///     order of key. None of them may already be present
+        /// \param n Number of elements to merge
+        void merge_backwards(Allocation& batch, const size_type* order, const size_type n) noexcept {
+            size_type dest = elem_count + n;
+            size_type i = elem_count;
+            size_type j = n;
+
+            //Once the batch is exhausted, the remaining elements are in place
+            while (j) {
+                --dest;
+
+                if (i && comparator(batch.keys[order[j - 1]], allocation.keys[i - 1])) {
+                    --i;
+                    place_element(dest, std::move(allocation.keys[i]), std::move(allocation.vals[i]));
+                } else {
+                    --j;
+                    place_element(dest, std::move(batch.keys[order[j]]), std::move(batch.vals[order[j]]));
+                }
+            }
+        }
+
+        ///
+        /// Merges elements and the current contents into a new allocation,
+        /// which then replaces the current one. Only the allocation may throw,
+        /// since merge_batch() requires nothrow moves.
+        ///
+        /// \param batch Allocation containing elements to merge
+        /// \param order Indices into batch of elements to merge in ascending
+        ///     order of key. None of them may already be present
+        /// \param n Number of elements to merge
+        /// \param new_capacity Capacity of new allocation
+        void merge_into_new_allocation(Allocation& batch, const size_type* order, const size_type n, const size_type new_capacity) {
+            Allocation new_allocation = allocate(new_capacity);
+
+            auto val_alloc = get_allocator();
+            auto key_alloc = key_allocator_type{val_alloc};
+
+            size_type dest = 0;
+            size_type i = 0;
+            for (size_type j = 0; j < n; ++j) {
+                const size_type b = order[j];
+
+                //Move the run of current elements preceding the new element
+                size_type run_end = i;
+                while (run_end < elem_count && comparator(allocation.keys[run_end], batch.keys[b])) {
+                    ++run_end;
+                }
+
+                aul::uninitialized_move(allocation.keys + i, allocation.keys + run_end, new_allocation.keys + dest, key_alloc);
+                aul::uninitialized_move(allocation.vals + i, allocation.vals + run_end, new_allocation.vals + dest, val_alloc);
+                dest += run_end - i;
+                i = run_end;
+
+                construct_key(new_allocation.keys + dest, std::move(batch.keys[b]));
+                construct_val(new_allocation.vals + dest, std::move(batch.vals[b]));
+                ++dest;
+            }
+
+            aul::uninitialized_move(allocation.keys + i, allocation.keys + elem_count, new_allocation.keys + dest, key_alloc);
+            aul::uninitialized_move(allocation.vals + i, allocation.vals + elem_count, new_allocation.vals + dest, val_alloc);
+
+            destroy_elements(allocation, elem_count);
+            deallocate(allocation);
+
+            allocation = std::move(new_allocation);
+        }
+
+        ///
+        /// Move constructs or move assigns a key and value into the
+        /// specified position depending on whether it is past the end of the
+        /// current elements
+        ///
+        /// \param i Position in current allocation
+        /// \param key Key to move
+        /// \param val Value to move
+        void place_element(const size_type i, key_type&& key, value_type&& val) noexcept {
+            if (i < elem_count) {
+                allocation.keys[i] = std::move(key);
+                allocation.vals[i] = std::move(val);
+            } else {
+                construct_key(allocation.keys + i, std::move(key));
+                construct_val(allocation.vals + i, std::move(val));
+            }
+        }
+
+        //=================================================
+        // Search helper functions
+        //=================================================
+
+        ///
+        /// If elements are buffered, and key is not present, the returned
+        /// pointer is instead to the end of the key array
+        ///
+        /// \param key Key to search for
+        /// \return Pointer to first key not less than key
+        template<class K2>
+        [[nodiscard]]
+        key_pointer search(const K2& key) const {
+            const size_type main_count = elem_count - buffer_count;
+            key_pointer ptr = search_index.lower_bound(allocation.keys, main_count, key, comparator);
+            if (!buffer_count) {
+                return ptr;
+            }
+
+            if (ptr != allocation.keys + main_count && compare_keys(*ptr, key)) {
+                return ptr;
+            }
+
+            const key_pointer keys_end = allocation.keys + elem_count;
+            ptr = aul::binary_search(allocation.keys + main_count, keys_end, key, comparator);
+            if (ptr != keys_end && compare_keys(*ptr, key)) {
+                return ptr;
+            }
+
+            return keys_end;
+        }
+
+        ///
+        /// \param key Object comparable with keys
+        /// \return key itself if it can be compared against keys directly,
+        ///     otherwise a key_type object converted from it
+        template<class K2>
+        [[nodiscard]]
+        static decltype(auto) as_key(const K2& key) {
+            if constexpr (std::is_same<K2, K>::value || is_transparent<K2>) {
+                return (key);
+            } else {
+                return key_type(key);
+            }
+        }
+
+        ///
+        /// Must only be called when no elements are buffered
+        ///
+        /// \param key Key to search for
+        /// \return Pointer to first key greater than key
+        template<class K2>
+        [[nodiscard]]
+        key_pointer search_upper(const K2& key) const {
+            key_pointer ptr = search(key);
+            if (ptr != allocation.keys + elem_count && compare_keys(*ptr, key)) {
+                ++ptr;
+            }
+            return ptr;
+        }
+
+        ///
+        /// \param first Pointer to first key in slice
+        /// \param last Pointer past last key in slice
+        /// \return Slice over the keys in [first, last) and their values
+        [[nodiscard]]
+        aul::Multispan<const key_type, value_type> slice(key_pointer first, key_pointer last) noexcept {
+            if (!allocation.keys) {
+                return {};
+            }
+
+            const size_type count = last - first;
+            return aul::Multispan<const key_type, value_type>{count, first, allocation.vals + (first - allocation.keys)};
+        }
+
+        ///
+        /// \param first Pointer to first key in slice
+        /// \param last Pointer past last key in slice
+        /// \return Slice over the keys in [first, last) and their values
+        [[nodiscard]]
+        aul::Multispan<const key_type, const value_type> slice(key_pointer first, key_pointer last) const noexcept {
+            if (!allocation.keys) {
+                return {};
+            }
+
+            const size_type count = last - first;
+            return aul::Multispan<const key_type, const value_type>{count, first, allocation.vals + (first - allocation.keys)};
+        }
+
+        ///
+        /// Applies bound to each sorted run of keys
+        ///
+        /// \tparam F Invocable taking pointers to the beginning and end of a
+        ///     run and returning a pair of pointers delimiting a subrange
+        /// \param bound Invocable to apply to each run
+        /// \return Slices over the subranges selected from the main run and
+        ///     from the buffered run
+        template<class F>
+        [[nodiscard]]
+        std::pair<aul::Multispan<const key_type, const value_type>, aul::Multispan<const key_type, const value_type>> slices_per_run(F bound) const {
+            const key_pointer main_end = allocation.keys + (elem_count - buffer_count);
+            const key_pointer keys_end = allocation.keys + elem_count;
+
+            const auto [main_first, main_last] = bound(allocation.keys, main_end);
+            const auto [buffer_first, buffer_last] = bound(main_end, keys_end);
+
+            return {slice(main_first, main_last), slice(buffer_first, buffer_last)};
+        }
+
+        ///
+        /// Advances a pair of cursors, one into each sorted run of keys, to
+        /// the specified key by galloping forwards
+        ///
+        /// \param main_pos Cursor into main run of keys
+        /// \param buffer_pos Cursor into buffered run of keys
+        /// \param key Key to search for
+        /// \return Pointer to key if present. Pointer to end of key array
+        ///     otherwise
+        [[nodiscard]]
+        key_pointer gallop(key_pointer& main_pos, key_pointer& buffer_pos, const key_type& key) const {
+            const key_pointer main_end = allocation.keys + (elem_count - buffer_count);
+            const key_pointer keys_end = allocation.keys + elem_count;
+
+            main_pos = aul::exponential_search(main_pos, main_end, key, comparator);
+            if (main_pos != main_end && compare_keys(*main_pos, key)) {
+                return main_pos;
+            }
+
+            if (buffer_count) {
+                buffer_pos = aul::exponential_search(buffer_pos, keys_end, key, comparator);
+                if (buffer_pos != keys_end && compare_keys(*buffer_pos, key)) {
+                    return buffer_pos;
+                }
+            }
+
+            return keys_end;
+        }
+
+        ///
+        /// Brings the search index up to date with the key array. If this
+        /// fails, lookups fall back to searching the key array directly
+        ///
+        void update_index() noexcept {
+            try {
+                search_index.rebuild(allocation.keys, elem_count - buffer_count);
+            } catch (...) {
+                search_index.clear();
+            }
+        }
+
         //=================================================
         // Misc. helper functions
         //=================================================
@@ -1382,16 +2825,17 @@ namespace aul {
         /// Compares keys for equality using internal comparator object
         ///
         /// \param a First key
-        /// \param b Second key
+        /// \param b Second key. May be of any type comparable with keys
         /// \return True if neither key compares less than the other
-        bool compare_keys(const key_type& a, const key_type& b) const {
+        template<class K2>
+        bool compare_keys(const key_type& a, const K2& b) const {
             return !comparator(a, b) && !comparator(b, a);
         }
 
     };
 
-    template<typename K, typename T, typename C, typename A>
-    class Array_map<K, T, C, A>::Value_comparator {
+    template<typename K, typename T, typename C, typename A, typename L, std::size_t N>
+    class Array_map<K, T, C, A, L, N>::Value_comparator {
     public:
 
         ///
@@ -1407,8 +2851,8 @@ namespace aul {
 
     };
 
-    template<typename K, typename T, typename C, typename A>
-    class Array_map<K, T, C, A>::Allocation {
+    template<typename K, typename T, typename C, typename A, typename L, std::size_t N>
+    class Array_map<K, T, C, A, L, N>::Allocation {
     public:
 
         //=================================================
@@ -1469,6 +2913,24 @@ namespace aul {
 
     };
 
+    ///
+    /// An aul::Array_map which stores up to N keys and values inside the
+    /// object itself, only allocating memory from the allocator once it
+    /// grows beyond that.
+    ///
+    /// Moving or swapping a map whose elements are stored inline moves the
+    /// elements individually.
+    ///
+    template<
+        typename K,
+        typename V,
+        std::size_t N,
+        typename C = std::less<K>,
+        typename A = std::allocator<V>,
+        typename L = Sorted_layout
+    >
+    using Small_array_map = Array_map<K, V, C, A, L, N>;
+
     #if __cplusplus >= 201703L
 
     //TODO: Add deduction guidelines
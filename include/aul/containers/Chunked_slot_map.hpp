@@ -0,0 +1,979 @@
+#ifndef AUL_CHUNKED_SLOT_MAP_HPP
+#define AUL_CHUNKED_SLOT_MAP_HPP
+
+#include "Slot_map.hpp"
+#include "../Bits.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aul {
+
+    ///
+    /// Class meant to be used as aul::Chunked_slot_map::iterator.
+    ///
+    /// Caches a pointer to the current element so that stepping through a
+    /// block is a pointer increment. The block table is only consulted when
+    /// crossing into the next block or when jumping.
+    ///
+    /// \tparam P Pointer type
+    /// \tparam Block_size Number of elements per block. Must be a power of two
+    template<class P, std::size_t Block_size>
+    class Chunked_slot_map_iterator {
+
+        template<class U, std::size_t B, class A>
+        friend class Chunked_slot_map;
+
+        template<class Q, std::size_t B>
+        friend class Chunked_slot_map_iterator;
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = typename std::iterator_traits<P>::value_type;
+        using difference_type = typename std::iterator_traits<P>::difference_type;
+        using reference = typename std::iterator_traits<P>::reference;
+        using pointer = P;
+        using iterator_category = std::random_access_iterator_tag;
+
+        using block_pointer = typename std::pointer_traits<P>::template rebind<value_type>;
+
+    private:
+
+        static constexpr difference_type block_shift = aul::log2(Block_size) - 1;
+
+        static constexpr difference_type block_mask = Block_size - 1;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        Chunked_slot_map_iterator(const block_pointer* blocks, const difference_type index):
+            blocks(blocks),
+            index(index),
+            ptr(blocks ? pointer{blocks[index >> block_shift] + (index & block_mask)} : pointer{}) {}
+
+        Chunked_slot_map_iterator() = default;
+        Chunked_slot_map_iterator(const Chunked_slot_map_iterator& it) = default;
+        Chunked_slot_map_iterator(Chunked_slot_map_iterator&& it) noexcept = default;
+        ~Chunked_slot_map_iterator() = default;
+
+        //=================================================
+        // Assignment operators/methods
+        //=================================================
+
+        Chunked_slot_map_iterator& operator=(const Chunked_slot_map_iterator& it) = default;
+        Chunked_slot_map_iterator& operator=(Chunked_slot_map_iterator&& it) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        bool operator==(const Chunked_slot_map_iterator it) const {
+            return (index == it.index) && (blocks == it.blocks);
+        }
+
+        [[nodiscard]]
+        bool operator!=(const Chunked_slot_map_iterator it) const {
+            return (index != it.index) || (blocks != it.blocks);
+        }
+
+        [[nodiscard]]
+        bool operator<(const Chunked_slot_map_iterator it) const {
+            return index < it.index;
+        }
+
+        [[nodiscard]]
+        bool operator>(const Chunked_slot_map_iterator it) const {
+            return index > it.index;
+        }
+
+        [[nodiscard]]
+        bool operator<=(const Chunked_slot_map_iterator it) const {
+            return index <= it.index;
+        }
+
+        [[nodiscard]]
+        bool operator>=(const Chunked_slot_map_iterator it) const {
+            return index >= it.index;
+        }
+
+        //=================================================
+        // Increment/Decrement operators
+        //=================================================
+
+        Chunked_slot_map_iterator& operator++() {
+            ++index;
+            if (index & block_mask) {
+                ++ptr;
+            } else {
+                ptr = blocks[index >> block_shift];
+            }
+            return *this;
+        }
+
+        Chunked_slot_map_iterator operator++(int) {
+            auto temp = *this;
+            operator++();
+            return temp;
+        }
+
+        Chunked_slot_map_iterator& operator--() {
+            if (index & block_mask) {
+                --ptr;
+                --index;
+            } else {
+                *this = Chunked_slot_map_iterator{blocks, index - 1};
+            }
+            return *this;
+        }
+
+        Chunked_slot_map_iterator operator--(int) {
+            auto temp = *this;
+            operator--();
+            return temp;
+        }
+
+        //=================================================
+        // Arithmetic operators
+        //=================================================
+
+        [[nodiscard]]
+        Chunked_slot_map_iterator operator+(const difference_type x) const {
+            return Chunked_slot_map_iterator{blocks, index + x};
+        }
+
+        [[nodiscard]]
+        Chunked_slot_map_iterator operator-(const difference_type x) const {
+            return Chunked_slot_map_iterator{blocks, index - x};
+        }
+
+        [[nodiscard]]
+        friend Chunked_slot_map_iterator operator+(const difference_type x, const Chunked_slot_map_iterator it) {
+            return it + x;
+        }
+
+        [[nodiscard]]
+        difference_type operator-(const Chunked_slot_map_iterator it) const {
+            return index - it.index;
+        }
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        Chunked_slot_map_iterator& operator+=(const difference_type x) {
+            return *this = *this + x;
+        }
+
+        Chunked_slot_map_iterator& operator-=(const difference_type x) {
+            return *this = *this - x;
+        }
+
+        //=================================================
+        // Dereference operators
+        //=================================================
+
+        [[nodiscard]]
+        reference operator*() const {
+            return *ptr;
+        }
+
+        [[nodiscard]]
+        reference operator[](const difference_type x) const {
+            return *(*this + x);
+        }
+
+        [[nodiscard]]
+        pointer operator->() const {
+            return ptr;
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        ///
+        /// Implicit conversion from iterator from non-const to iterator to
+        /// const
+        ///
+        /// \return Iterator to const which points to same location as this object
+        [[nodiscard]]
+        operator Chunked_slot_map_iterator<typename std::pointer_traits<P>::template rebind<const value_type>, Block_size>() const {
+            Chunked_slot_map_iterator<typename std::pointer_traits<P>::template rebind<const value_type>, Block_size> ret{};
+            ret.blocks = blocks;
+            ret.index = index;
+            ret.ptr = ptr;
+            return ret;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        const block_pointer* blocks = nullptr;
+        difference_type index{};
+        pointer ptr{};
+
+    };
+
+
+
+    ///
+    /// A variant of aul::Slot_map which stores its elements in fixed-size
+    /// blocks rather than in a single array.
+    ///
+    /// Growing the container allocates new blocks and appends them to a table
+    /// of blocks. Existing elements and their metadata are never moved or
+    /// copied as a result, so growth costs O(1) element operations and
+    /// pointers to elements are only invalidated by erasures, which, as with
+    /// aul::Slot_map, move the last element into the vacated position.
+    ///
+    /// Elements are kept densely packed and iteration walks the container
+    /// block by block. Keys are the same aul::Slot_map_key objects used by
+    /// aul::Slot_map.
+    ///
+    /// \tparam T Element type
+    /// \tparam Block_size Number of elements per block. Must be a power of two
+    /// \tparam A Allocator type
+    template<class T, std::size_t Block_size = 64, class A = std::allocator<T>>
+    class Chunked_slot_map {
+
+        static_assert(aul::is_pow2(Block_size), "Block_size must be a power of two");
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        class Metadata;
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+    public:
+
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using pointer = typename std::allocator_traits<allocator_type>::pointer;
+        using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
+
+        using value_type = T;
+        using key_type = Slot_map_key<size_type>;
+
+        using reference = T&;
+        using const_reference = const T&;
+
+        using iterator = Chunked_slot_map_iterator<pointer, Block_size>;
+        using const_iterator = Chunked_slot_map_iterator<const_pointer, Block_size>;
+
+    private:
+
+        using allocator_traits = std::allocator_traits<allocator_type>;
+
+        using md_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Metadata>;
+        using md_allocator_traits = std::allocator_traits<md_allocator_type>;
+        using md_pointer = typename md_allocator_traits::pointer;
+
+        using table_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<pointer>;
+        using table_allocator_traits = std::allocator_traits<table_allocator_type>;
+        using table_pointer = typename table_allocator_traits::pointer;
+
+        using md_table_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<md_pointer>;
+        using md_table_allocator_traits = std::allocator_traits<md_table_allocator_type>;
+        using md_table_pointer = typename md_table_allocator_traits::pointer;
+
+        //=================================================
+        // Static constants
+        //=================================================
+
+    public:
+
+        static constexpr size_type block_size = Block_size;
+
+    private:
+
+        static constexpr size_type block_shift = aul::log2(Block_size) - 1;
+
+        static constexpr size_type block_mask = Block_size - 1;
+
+        static constexpr size_type null_index = std::numeric_limits<size_type>::max();
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        ///
+        /// Default constructor
+        ///
+        Chunked_slot_map() noexcept(noexcept(allocator_type{})) = default;
+
+        ///
+        /// \param alloc Allocator to copy-construct internal allocators from
+        ///
+        explicit Chunked_slot_map(const allocator_type& alloc):
+            allocator(alloc) {}
+
+        ///
+        /// \param right Source object
+        ///
+        Chunked_slot_map(Chunked_slot_map&& right) noexcept:
+            allocator(std::move(right.allocator)),
+            element_blocks(std::exchange(right.element_blocks, nullptr)),
+            metadata_blocks(std::exchange(right.metadata_blocks, nullptr)),
+            table_capacity(std::exchange(right.table_capacity, 0)),
+            block_count(std::exchange(right.block_count, 0)),
+            elem_count(std::exchange(right.elem_count, 0)),
+            free_anchor(std::exchange(right.free_anchor, null_index)) {}
+
+        ///
+        /// \param src Source object
+        ///
+        Chunked_slot_map(const Chunked_slot_map& src):
+            Chunked_slot_map(src, allocator_traits::select_on_container_copy_construction(src.allocator)) {}
+
+        ///
+        /// \param src Source object
+        /// \param alloc Source for copy-construction of internal allocator
+        Chunked_slot_map(const Chunked_slot_map& src, const allocator_type& alloc):
+            allocator(alloc) {
+
+            static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
+
+            try {
+                copy_metadata(src);
+
+                for (; elem_count != src.elem_count; ++elem_count) {
+                    allocator_traits::construct(allocator, element_at(elem_count), *src.element_at(elem_count));
+                }
+            } catch (...) {
+                clear();
+                throw;
+            }
+        }
+
+        ///
+        /// Destructor
+        ///
+        ~Chunked_slot_map() {
+            clear();
+        }
+
+        //=================================================
+        // Modifier methods
+        //=================================================
+
+        ///
+        /// Destructs current contents. Reduces capacity to 0. All keys are
+        /// invalidated. Keys issued after a call to clear may be equal to
+        /// previously used keys.
+        ///
+        void clear() noexcept {
+            md_allocator_type md_allocator{allocator};
+
+            for (size_type i = 0; i != elem_count; ++i) {
+                allocator_traits::destroy(allocator, element_at(i));
+            }
+
+            for (size_type k = 0; k != block_count; ++k) {
+                aul::destroy(metadata_blocks[k], metadata_blocks[k] + Block_size, md_allocator);
+                md_allocator_traits::deallocate(md_allocator, metadata_blocks[k], Block_size);
+                allocator_traits::deallocate(allocator, element_blocks[k], Block_size);
+            }
+
+            deallocate_tables(element_blocks, metadata_blocks, table_capacity);
+
+            element_blocks = nullptr;
+            metadata_blocks = nullptr;
+            table_capacity = 0;
+            block_count = 0;
+            elem_count = 0;
+            free_anchor = null_index;
+        }
+
+        /// Replaces the contents of the current object those of src. Also swaps
+        /// allocators if necessary.
+        ///
+        /// \param src Target object to swap with
+        ///
+        void swap(Chunked_slot_map& src) noexcept (aul::is_noexcept_swappable_v<A>) {
+            if constexpr (allocator_traits::propagate_on_container_swap::value) {
+                std::swap(allocator, src.allocator);
+            }
+
+            std::swap(element_blocks, src.element_blocks);
+            std::swap(metadata_blocks, src.metadata_blocks);
+            std::swap(table_capacity, src.table_capacity);
+            std::swap(block_count, src.block_count);
+            std::swap(elem_count, src.elem_count);
+            std::swap(free_anchor, src.free_anchor);
+        }
+
+        ///
+        /// \param l Left map to swap
+        /// \param r Right map to swap
+        ///
+        friend void swap(Chunked_slot_map& l, Chunked_slot_map& r) noexcept (aul::is_noexcept_swappable_v<A>) {
+            l.swap(r);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        ///
+        /// \param  src
+        /// \return Current object
+        Chunked_slot_map& operator=(const Chunked_slot_map& src) {
+            if (this == &src) {
+                return *this;
+            }
+
+            if constexpr (allocator_traits::propagate_on_container_copy_assignment::value) {
+                Chunked_slot_map temp{src, src.allocator};
+                clear();
+                allocator = src.allocator;
+                swap_contents(temp);
+            } else {
+                Chunked_slot_map temp{src, allocator};
+                swap_contents(temp);
+            }
+
+            return *this;
+        }
+
+        /// Move assignment operator
+        /// \param src Target object to move from
+        /// \return Current object
+        Chunked_slot_map& operator=(Chunked_slot_map&& src) noexcept(aul::is_noexcept_movable_v<A>) {
+            if (this == &src) {
+                return *this;
+            }
+
+            clear();
+
+            if constexpr (allocator_traits::propagate_on_container_move_assignment::value) {
+                allocator = std::move(src.allocator);
+            } else if (allocator != src.allocator) {
+                copy_metadata(src);
+                for (; elem_count != src.elem_count; ++elem_count) {
+                    allocator_traits::construct(allocator, element_at(elem_count), std::move(*src.element_at(elem_count)));
+                }
+
+                src.clear();
+                return *this;
+            }
+
+            swap_contents(src);
+            return *this;
+        }
+
+        //=================================================
+        // Element access operators/methods
+        //=================================================
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        [[nodiscard]]
+        T& operator[](const key_type key) noexcept {
+            return *element_at(metadata_at(key.index)->anchor.data());
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        [[nodiscard]]
+        const T& operator[](const key_type key) const noexcept {
+            return *element_at(metadata_at(key.index)->anchor.data());
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        ///
+        [[nodiscard]]
+        T& at(const key_type key) {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Chunked_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        ///
+        [[nodiscard]]
+        const T& at(const key_type key) const {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Chunked_slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        //=================================================
+        // Element addition
+        //=================================================
+
+        /// Constructs an object from a set of parameters. If the container is
+        /// full, a single new block is allocated. No existing elements are
+        /// moved.
+        ///
+        /// \tparam Args Argument types for constructor call
+        /// \param args  Constructor arguments for construction of new element
+        /// \return      Key mapped to newly constructed object
+        template<class... Args>
+        key_type emplace(Args&&...args) {
+            if (size() == capacity()) {
+                reserve(capacity() + Block_size);
+            }
+
+            allocator_traits::construct(allocator, element_at(elem_count), std::forward<Args>(args)...);
+
+            const size_type anchor_index = consume_anchor(elem_count);
+            ++elem_count;
+
+            return key_type{anchor_index, metadata_at(anchor_index)->anchor.version()};
+        }
+
+        iterator insert(const T& v) {
+            emplace(v);
+            return end() - 1;
+        }
+
+        iterator insert(T&& v) {
+            emplace(std::move(v));
+            return end() - 1;
+        }
+
+        //=================================================
+        // Element removal
+        //=================================================
+
+        ///
+        /// \param key Key mapping to element to remove
+        /// \return True if an element was removed
+        bool erase(const key_type key) noexcept {
+            if (!contains(key)) {
+                return false;
+            }
+
+            erase_at(metadata_at(key.index)->anchor.data());
+            return true;
+        }
+
+        ///
+        /// \param it Valid iterator to element to erase
+        ///
+        void erase(const_iterator it) noexcept {
+            erase_at(static_cast<size_type>(it.index));
+        }
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return iterator{aul::to_raw_pointer(element_blocks), 0};
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return const_iterator{aul::to_raw_pointer(element_blocks), 0};
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return iterator{aul::to_raw_pointer(element_blocks), static_cast<difference_type>(elem_count)};
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return const_iterator{aul::to_raw_pointer(element_blocks), static_cast<difference_type>(elem_count)};
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        //=================================================
+        // Size & capacity methods
+        //=================================================
+
+        ///
+        /// \return True if container has no elements
+        ///
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return elem_count == 0;
+        }
+
+        ///
+        /// \return Number of elements the allocated blocks can hold
+        ///
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return block_count * Block_size;
+        }
+
+        ///
+        /// \return Element count
+        ///
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count;
+        }
+
+        ///
+        /// \return Maximum capacity container may reach.
+        ///
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            constexpr size_type size_type_max = std::numeric_limits<difference_type>::max() - Block_size;
+            return std::min(size_type_max, allocator_traits::max_size(allocator));
+        }
+
+        ///
+        /// Allocates enough blocks to store at least n elements. Only the
+        /// table of blocks is ever reallocated.
+        ///
+        /// \param n Number of elements to allocate memory for
+        ///
+        void reserve(const size_type n) {
+            if (n <= capacity()) {
+                return;
+            }
+
+            if (max_size() < n) {
+                throw std::length_error("aul::Chunked_slot_map grew beyond max size");
+            }
+
+            const size_type new_block_count = (n + Block_size - 1) >> block_shift;
+
+            //The table always has at least one null entry past the last block
+            if (table_capacity <= new_block_count) {
+                grow_table(std::max(new_block_count + 1, 2 * table_capacity));
+            }
+
+            while (block_count != new_block_count) {
+                add_block();
+            }
+        }
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        friend bool operator==(const Chunked_slot_map& lhs, const Chunked_slot_map& rhs) {
+            return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+        }
+
+        [[nodiscard]]
+        friend bool operator!=(const Chunked_slot_map& lhs, const Chunked_slot_map& rhs) {
+            return !operator==(lhs, rhs);
+        }
+
+        //=================================================
+        // Misc. methods
+        //=================================================
+
+        /// \param it Iterator to element
+        /// \return   key corresponding to element pointed to be it
+        ///
+        [[nodiscard]]
+        key_type get_key(const_iterator it) const noexcept {
+            const size_type anchor_index = metadata_at(static_cast<size_type>(it.index))->anchor_index;
+            return key_type{anchor_index, metadata_at(anchor_index)->anchor.version()};
+        }
+
+        /// \param key Key to be checked
+        /// \return    Returns true if the key maps to a valid element
+        ///
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return (key.index < capacity()) && (key.version == metadata_at(key.index)->anchor.version());
+        }
+
+        ///
+        /// \return Copy of internal allocator
+        ///
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        table_pointer element_blocks = nullptr;
+
+        md_table_pointer metadata_blocks = nullptr;
+
+        size_type table_capacity = 0;
+
+        size_type block_count = 0;
+
+        size_type elem_count = 0;
+
+        size_type free_anchor = null_index;
+
+        //=================================================
+        // Element & metadata access helpers
+        //=================================================
+
+        [[nodiscard]]
+        pointer element_at(const size_type i) const noexcept {
+            return element_blocks[i >> block_shift] + (i & block_mask);
+        }
+
+        [[nodiscard]]
+        md_pointer metadata_at(const size_type i) const noexcept {
+            return metadata_blocks[i >> block_shift] + (i & block_mask);
+        }
+
+        ///
+        /// Moves the last element into position pos and releases the anchor
+        /// of the element at pos
+        ///
+        /// \param pos Position of element to erase
+        void erase_at(const size_type pos) noexcept {
+            const size_type last = elem_count - 1;
+            const size_type anchor_index = metadata_at(pos)->anchor_index;
+
+            if (pos != last) {
+                *element_at(pos) = std::move(*element_at(last));
+
+                const size_type moved_anchor = metadata_at(last)->anchor_index;
+                metadata_at(pos)->anchor_index = moved_anchor;
+                metadata_at(moved_anchor)->anchor.data() = pos;
+            }
+
+            allocator_traits::destroy(allocator, element_at(last));
+            release_anchor(anchor_index);
+            --elem_count;
+        }
+
+        //=================================================
+        // Anchor helper methods
+        //=================================================
+
+        /// Takes an anchor off the free list and points it at pos
+        ///
+        /// \pre The free list must not be empty
+        /// \param pos Position of element to anchor
+        /// \return Index of consumed anchor
+        size_type consume_anchor(const size_type pos) noexcept {
+            const size_type anchor_index = free_anchor;
+            md_pointer md = metadata_at(anchor_index);
+
+            //An anchor which points to itself terminates the list
+            const size_type next = md->anchor.data();
+            free_anchor = (next == anchor_index) ? null_index : next;
+
+            md->anchor.data() = pos;
+            metadata_at(pos)->anchor_index = anchor_index;
+
+            return anchor_index;
+        }
+
+        /// Pushes the anchor at anchor_index onto the free list. Increments
+        /// the anchor's version.
+        ///
+        void release_anchor(const size_type anchor_index) noexcept {
+            metadata_at(anchor_index)->anchor = (free_anchor == null_index) ? anchor_index : free_anchor;
+            free_anchor = anchor_index;
+        }
+
+        //=================================================
+        // Allocation helper methods
+        //=================================================
+
+        ///
+        /// Allocates one element block and one metadata block. The new anchors
+        /// are pushed onto the front of the free list.
+        ///
+        /// \pre block_count < table_capacity - 1
+        void add_block() {
+            md_allocator_type md_allocator{allocator};
+
+            pointer elements = allocator_traits::allocate(allocator, Block_size);
+
+            md_pointer metadata;
+            try {
+                metadata = md_allocator_traits::allocate(md_allocator, Block_size);
+            } catch (...) {
+                allocator_traits::deallocate(allocator, elements, Block_size);
+                throw;
+            }
+
+            const size_type base = block_count * Block_size;
+            for (size_type i = 0; i != Block_size - 1; ++i) {
+                md_allocator_traits::construct(md_allocator, metadata + i, base + i + 1);
+            }
+
+            const size_type last_next = (free_anchor == null_index) ? base + Block_size - 1 : free_anchor;
+            md_allocator_traits::construct(md_allocator, metadata + Block_size - 1, last_next);
+
+            element_blocks[block_count] = elements;
+            metadata_blocks[block_count] = metadata;
+            ++block_count;
+
+            free_anchor = base;
+        }
+
+        ///
+        /// Reallocates the tables of blocks. The blocks themselves are not
+        /// touched.
+        ///
+        /// \param n New table capacity. Must be greater than block_count
+        void grow_table(const size_type n) {
+            table_allocator_type table_allocator{allocator};
+            md_table_allocator_type md_table_allocator{allocator};
+
+            table_pointer new_elements = table_allocator_traits::allocate(table_allocator, n);
+
+            md_table_pointer new_metadata;
+            try {
+                new_metadata = md_table_allocator_traits::allocate(md_table_allocator, n);
+            } catch (...) {
+                table_allocator_traits::deallocate(table_allocator, new_elements, n);
+                throw;
+            }
+
+            for (size_type k = 0; k != n; ++k) {
+                table_allocator_traits::construct(table_allocator, new_elements + k, (k < block_count) ? element_blocks[k] : pointer{});
+                md_table_allocator_traits::construct(md_table_allocator, new_metadata + k, (k < block_count) ? metadata_blocks[k] : md_pointer{});
+            }
+
+            deallocate_tables(element_blocks, metadata_blocks, table_capacity);
+
+            element_blocks = new_elements;
+            metadata_blocks = new_metadata;
+            table_capacity = n;
+        }
+
+        void deallocate_tables(table_pointer elements, md_table_pointer metadata, const size_type n) noexcept {
+            if (!n) {
+                return;
+            }
+
+            table_allocator_type table_allocator{allocator};
+            md_table_allocator_type md_table_allocator{allocator};
+
+            aul::destroy(elements, elements + n, table_allocator);
+            aul::destroy(metadata, metadata + n, md_table_allocator);
+
+            table_allocator_traits::deallocate(table_allocator, elements, n);
+            md_table_allocator_traits::deallocate(md_table_allocator, metadata, n);
+        }
+
+        ///
+        /// Allocates as many blocks as src has and copies its metadata so that
+        /// src's keys are valid for this object.
+        ///
+        /// \pre This object must be empty
+        void copy_metadata(const Chunked_slot_map& src) {
+            reserve(src.capacity());
+
+            for (size_type k = 0; k != block_count; ++k) {
+                std::copy_n(src.metadata_blocks[k], Block_size, metadata_blocks[k]);
+            }
+
+            free_anchor = src.free_anchor;
+        }
+
+        ///
+        /// Swaps everything except for the allocator
+        ///
+        void swap_contents(Chunked_slot_map& src) noexcept {
+            std::swap(element_blocks, src.element_blocks);
+            std::swap(metadata_blocks, src.metadata_blocks);
+            std::swap(table_capacity, src.table_capacity);
+            std::swap(block_count, src.block_count);
+            std::swap(elem_count, src.elem_count);
+            std::swap(free_anchor, src.free_anchor);
+        }
+
+    };
+
+    template<class T, std::size_t Block_size, class A>
+    class Chunked_slot_map<T, Block_size, A>::Metadata {
+    public:
+
+        //=============================================
+        // -ctors
+        //=============================================
+
+        Metadata() = default;
+
+        explicit Metadata(const size_type anchor):
+            anchor(anchor, 1) {}
+
+        Metadata(const Metadata&) = default;
+        Metadata(Metadata&&) = default;
+
+        ~Metadata() = default;
+
+        //=============================================
+        // Assignment operators
+        //=============================================
+
+        Metadata& operator=(const Metadata&) = default;
+        Metadata& operator=(Metadata&&) = default;
+
+        //=============================================
+        // Instance members
+        //=============================================
+
+        ///
+        /// Index of the anchor for the element at this metadata's position
+        ///
+        size_type anchor_index = 0;
+
+        ///
+        /// Position of anchored element, or next free anchor when unused
+        ///
+        aul::Versioned_type<size_type, size_type> anchor{0, 1};
+
+    };
+
+}
+
+#endif //AUL_CHUNKED_SLOT_MAP_HPP
@@ -1,8 +1,12 @@
 #ifndef AUL_CIRCULAR_ARRAY_HPP
 #define AUL_CIRCULAR_ARRAY_HPP
 
+#include <cstring>
+#include <functional>
 #include <memory>
+#include <numeric>
 #include <tuple>
+#include <type_traits>
 #include <stdexcept>
 #include <initializer_list>
 #include <limits>
@@ -11,12 +15,57 @@
 #include <utility>
 
 #include <aul/containers/Allocator_aware_base.hpp>
+#include <aul/Span.hpp>
 #include <aul/memory/Allocation.hpp>
 #include <aul/Algorithms.hpp>
 #include <aul/memory/Memory.hpp>
 
 namespace aul {
 
+    ///
+    /// Capacity policy for aul::Circular_array under which the allocation may
+    /// be of any size. Locating an element requires a comparison against the
+    /// end of the allocation.
+    ///
+    struct Arbitrary_capacity {};
+
+    ///
+    /// Capacity policy for aul::Circular_array under which the allocation's
+    /// size is always a power of two, so that the position of an element is
+    /// found by masking its offset from the head, without any branches.
+    /// Best suited to workloads dominated by random access.
+    ///
+    struct Power_of_two_capacity {};
+
+    namespace impl {
+
+        ///
+        /// Detects allocators, such as aul::Memory_mapped_allocator, whose
+        /// allocations are immediately followed by a mirror of themselves
+        ///
+        template<class A, class = void>
+        struct is_mirrored_allocator : std::false_type {};
+
+        template<class A>
+        struct is_mirrored_allocator<A, std::void_t<typename A::is_mirrored>> : A::is_mirrored {};
+
+        ///
+        /// Detects allocators, such as aul::Remappable_allocator, which can
+        /// resize an existing allocation through a member function
+        /// reallocate(p, old_n, new_n)
+        ///
+        template<class A, class = void>
+        struct is_reallocating_allocator : std::false_type {};
+
+        template<class A>
+        struct is_reallocating_allocator<A, std::void_t<decltype(std::declval<A&>().reallocate(
+            std::declval<typename std::allocator_traits<A>::pointer>(),
+            std::declval<typename std::allocator_traits<A>::size_type>(),
+            std::declval<typename std::allocator_traits<A>::size_type>()
+        ))>> : std::true_type {};
+
+    }
+
     ///
     /// Class meant to be used as aul::Circular_array::iterator.
     ///
@@ -175,7 +224,30 @@ namespace aul {
 
         [[nodiscard]]
         pointer operator->() const {
-            return (offset < 0 ? end  : begin) + offset;
+            if (offset < 0) {
+                return end + offset;
+            }
+
+            //Positions past the end of the allocation wrap around to its start
+            const difference_type capacity = end - begin;
+            return begin + (offset < capacity ? offset : offset - capacity);
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Number of elements from this position up to the end of the
+        ///     allocation, which are contiguous in memory
+        [[nodiscard]]
+        difference_type contiguous_extent() const noexcept {
+            if (offset < 0) {
+                return -offset;
+            }
+
+            const difference_type capacity = end - begin;
+            return (offset < capacity) ? capacity - offset : 2 * capacity - offset;
         }
 
         //=================================================
@@ -204,15 +276,449 @@ namespace aul {
 
     };
 
+    ///
+    /// Class meant to be used as aul::Circular_array::iterator under the
+    /// aul::Power_of_two_capacity policy.
+    ///
+    /// The offset is a position relative to the start of the allocation which
+    /// is reduced modulo the allocation's size with a mask when dereferenced.
+    ///
+    /// \tparam P Pointer type
+    template<class P>
+    class Masked_circular_array_iterator {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = typename std::iterator_traits<P>::value_type;
+        using difference_type = typename std::iterator_traits<P>::difference_type;
+        using reference = value_type&;
+        using pointer = P;
+        using iterator_category = std::random_access_iterator_tag;
+
+        using size_type = typename std::make_unsigned<difference_type>::type;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Masked_circular_array_iterator(const difference_type offset, pointer p, const size_type mask):
+            offset(offset),
+            ptr(p),
+            mask(mask) {}
+
+        Masked_circular_array_iterator() = default;
+        Masked_circular_array_iterator(const Masked_circular_array_iterator& it) = default;
+        Masked_circular_array_iterator(Masked_circular_array_iterator&& it) noexcept = default;
+        ~Masked_circular_array_iterator() = default;
+
+        //=================================================
+        // Assignment operators/methods
+        //=================================================
+
+        Masked_circular_array_iterator& operator=(const Masked_circular_array_iterator& it) = default;
+        Masked_circular_array_iterator& operator=(Masked_circular_array_iterator&& it) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        bool operator==(const Masked_circular_array_iterator it) const {
+            return (offset == it.offset) && (ptr == it.ptr);
+        }
+
+        [[nodiscard]]
+        bool operator!=(const Masked_circular_array_iterator it) const {
+            return (offset != it.offset) || (ptr != it.ptr);
+        }
+
+        [[nodiscard]]
+        bool operator<(const Masked_circular_array_iterator it) const {
+            return offset < it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator>(const Masked_circular_array_iterator it) const {
+            return offset > it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator<=(const Masked_circular_array_iterator it) const {
+            return offset <= it.offset;
+        }
+
+        [[nodiscard]]
+        bool operator>=(const Masked_circular_array_iterator it) const {
+            return offset >= it.offset;
+        }
+
+        //=================================================
+        // Increment/Decrement operators
+        //=================================================
+
+        Masked_circular_array_iterator operator++() {
+            ++offset;
+            return *this;
+        }
+
+        Masked_circular_array_iterator operator++(int) {
+            auto temp = *this;
+            ++offset;
+            return temp;
+        }
+
+        Masked_circular_array_iterator operator--() {
+            --offset;
+            return *this;
+        }
+
+        Masked_circular_array_iterator operator--(int) {
+            auto temp = *this;
+            --offset;
+            return temp;
+        }
+
+        //=================================================
+        // Arithmetic operators
+        //=================================================
+
+        [[nodiscard]]
+        Masked_circular_array_iterator operator+(const difference_type x) const {
+            auto temp = *this;
+            temp.offset += x;
+            return temp;
+        }
+
+        [[nodiscard]]
+        Masked_circular_array_iterator operator-(const difference_type x) const {
+            auto temp = *this;
+            temp.offset -= x;
+            return temp;
+        }
+
+        [[nodiscard]]
+        friend Masked_circular_array_iterator operator+(const difference_type x, Masked_circular_array_iterator it) {
+            it.offset += x;
+            return it;
+        }
+
+        [[nodiscard]]
+        difference_type operator-(const Masked_circular_array_iterator it) const {
+            return offset - it.offset;
+        }
+
+        //=================================================
+        // Arithmetic assignment operators
+        //=================================================
+
+        Masked_circular_array_iterator operator+=(const difference_type x) {
+            offset += x;
+            return *this;
+        }
+
+        Masked_circular_array_iterator operator-=(const difference_type x) {
+            offset -= x;
+            return *this;
+        }
+
+        //=================================================
+        // Dereference operators
+        //=================================================
+
+        [[nodiscard]]
+        reference operator*() const {
+            return *operator->();
+        }
+
+        [[nodiscard]]
+        reference operator[](const difference_type x) const {
+            return *(*this + x);
+        }
+
+        [[nodiscard]]
+        pointer operator->() const {
+            return ptr + (static_cast<size_type>(offset) & mask);
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Number of elements from this position up to the end of the
+        ///     allocation, which are contiguous in memory
+        [[nodiscard]]
+        difference_type contiguous_extent() const noexcept {
+            return static_cast<difference_type>(mask - (static_cast<size_type>(offset) & mask) + 1);
+        }
+
+        //=================================================
+        // Conversion operators
+        //=================================================
+
+        ///
+        /// Implicit conversion from iterator from non-const to iterator to
+        /// const
+        ///
+        /// \return Iterator to const which points to same location as this object
+        [[nodiscard]]
+        operator Masked_circular_array_iterator<typename std::pointer_traits<P>::template rebind<const value_type>>() const {
+            return {offset, ptr, mask};
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        difference_type offset{};
+        pointer ptr{};
+        size_type mask{};
+
+    };
+
+    //=====================================================
+    // Segment-aware algorithms
+    //=====================================================
+
+    namespace impl {
+
+        template<class It>
+        struct is_circular_array_iterator : std::false_type {};
+
+        template<class P>
+        struct is_circular_array_iterator<Circular_array_iterator<P>> : std::true_type {};
+
+        template<class P>
+        struct is_circular_array_iterator<Masked_circular_array_iterator<P>> : std::true_type {};
+
+    }
+
+    ///
+    /// Invokes f once for each run of elements in [first, last) which is
+    /// contiguous in memory. A range within a single aul::Circular_array
+    /// consists of at most two such runs.
+    ///
+    /// \tparam It aul::Circular_array iterator type
+    /// \tparam F Invocable taking a pointer to the beginning and a pointer to
+    ///     the end of a run
+    /// \param first Iterator to beginning of range
+    /// \param last Iterator to end of range
+    /// \param f Invocable to call on each run
+    /// \return f
+    template<class It, class F, class = std::enable_if_t<impl::is_circular_array_iterator<It>::value>>
+    F for_each_segment(It first, const It last, F f) {
+        while (first < last) {
+            const auto n = std::min(last - first, first.contiguous_extent());
+            const auto p = first.operator->();
+            f(p, p + n);
+            first += n;
+        }
+
+        return f;
+    }
+
+    namespace impl {
+
+        ///
+        /// Copies [first, last) to d_first, splitting d_first's range into
+        /// contiguous runs if it's an aul::Circular_array iterator
+        ///
+        template<class In, class Out>
+        Out copy_to_segments(In first, const In last, Out d_first) {
+            if constexpr (is_circular_array_iterator<Out>::value) {
+                const Out d_last = d_first + std::distance(first, last);
+                aul::for_each_segment(d_first, d_last, [&first] (auto p0, auto p1) {
+                    const In next = std::next(first, p1 - p0);
+                    std::copy(first, next, p0);
+                    first = next;
+                });
+                return d_last;
+            } else {
+                return std::copy(first, last, d_first);
+            }
+        }
+
+        ///
+        /// Transforms [first, last) into d_first, splitting d_first's range
+        /// into contiguous runs if it's an aul::Circular_array iterator
+        ///
+        template<class In, class Out, class Op>
+        Out transform_to_segments(In first, const In last, Out d_first, Op& op) {
+            if constexpr (is_circular_array_iterator<Out>::value) {
+                const Out d_last = d_first + std::distance(first, last);
+                aul::for_each_segment(d_first, d_last, [&first, &op] (auto p0, auto p1) {
+                    const In next = std::next(first, p1 - p0);
+                    std::transform(first, next, p0, op);
+                    first = next;
+                });
+                return d_last;
+            } else {
+                return std::transform(first, last, d_first, op);
+            }
+        }
+
+        ///
+        /// Allocator-aware counterpart to aul::copy which constructs the
+        /// copies in uninitialized memory. If a copy throws, the newly
+        /// constructed objects are destroyed.
+        ///
+        /// In must be a random access iterator type
+        ///
+        template<class In, class Out, class Alloc>
+        Out uninitialized_copy_segments(In first, const In last, const Out d_first, Alloc& alloc) {
+            if constexpr (is_circular_array_iterator<In>::value) {
+                Out d = d_first;
+                try {
+                    aul::for_each_segment(first, last, [&d, &alloc] (auto p0, auto p1) {
+                        d = impl::uninitialized_copy_segments(p0, p1, d, alloc);
+                    });
+                } catch (...) {
+                    aul::destroy(d_first, d, alloc);
+                    throw;
+                }
+                return d;
+            } else if constexpr (is_circular_array_iterator<Out>::value) {
+                Out d = d_first;
+                const Out d_last = d_first + (last - first);
+                try {
+                    aul::for_each_segment(d_first, d_last, [&first, &d, &alloc] (auto p0, auto p1) {
+                        const In next = first + (p1 - p0);
+                        aul::uninitialized_copy(first, next, p0, alloc);
+                        first = next;
+                        d += (p1 - p0);
+                    });
+                } catch (...) {
+                    aul::destroy(d_first, d, alloc);
+                    throw;
+                }
+                return d_last;
+            } else {
+                return aul::uninitialized_copy(first, last, d_first, alloc);
+            }
+        }
+
+    }
+
+    ///
+    /// Equivalent to std::copy, but copies between plain contiguous runs of
+    /// memory so that the copies may be vectorized. Used when either range
+    /// belongs to an aul::Circular_array.
+    ///
+    /// \tparam In Forward iterator type
+    /// \tparam Out Forward iterator type
+    /// \param first Iterator to beginning of source range
+    /// \param last Iterator to end of source range
+    /// \param d_first Iterator to beginning of destination range
+    /// \return Iterator to end of destination range
+    template<
+        class In,
+        class Out,
+        class = std::enable_if_t<impl::is_circular_array_iterator<In>::value || impl::is_circular_array_iterator<Out>::value>
+    >
+    Out copy(const In first, const In last, Out d_first) {
+        if constexpr (impl::is_circular_array_iterator<In>::value) {
+            aul::for_each_segment(first, last, [&d_first] (auto p0, auto p1) {
+                d_first = impl::copy_to_segments(p0, p1, d_first);
+            });
+            return d_first;
+        } else {
+            return impl::copy_to_segments(first, last, d_first);
+        }
+    }
+
+    ///
+    /// Equivalent to std::transform, but operates on plain contiguous runs of
+    /// memory so that the loops may be vectorized. Used when either range
+    /// belongs to an aul::Circular_array.
+    ///
+    /// \tparam In Forward iterator type
+    /// \tparam Out Forward iterator type
+    /// \tparam Op Unary operation type
+    /// \param first Iterator to beginning of source range
+    /// \param last Iterator to end of source range
+    /// \param d_first Iterator to beginning of destination range
+    /// \param op Operation to apply to each element
+    /// \return Iterator to end of destination range
+    template<
+        class In,
+        class Out,
+        class Op,
+        class = std::enable_if_t<impl::is_circular_array_iterator<In>::value || impl::is_circular_array_iterator<Out>::value>
+    >
+    Out transform(const In first, const In last, Out d_first, Op op) {
+        if constexpr (impl::is_circular_array_iterator<In>::value) {
+            aul::for_each_segment(first, last, [&d_first, &op] (auto p0, auto p1) {
+                d_first = impl::transform_to_segments(p0, p1, d_first, op);
+            });
+            return d_first;
+        } else {
+            return impl::transform_to_segments(first, last, d_first, op);
+        }
+    }
+
+    ///
+    /// Equivalent to std::fill over the contiguous runs of an
+    /// aul::Circular_array range
+    ///
+    /// \tparam It aul::Circular_array iterator type
+    /// \tparam T Value type
+    /// \param first Iterator to beginning of range
+    /// \param last Iterator to end of range
+    /// \param val Value to assign to each element
+    template<class It, class T, class = std::enable_if_t<impl::is_circular_array_iterator<It>::value>>
+    void fill(const It first, const It last, const T& val) {
+        aul::for_each_segment(first, last, [&val] (auto p0, auto p1) {
+            std::fill(p0, p1, val);
+        });
+    }
+
+    ///
+    /// Equivalent to std::reduce over the contiguous runs of an
+    /// aul::Circular_array range. As with std::reduce, op may be applied in
+    /// any order and grouping, so it must be associative and commutative.
+    ///
+    /// \tparam It aul::Circular_array iterator type
+    /// \tparam T Accumulator type
+    /// \tparam Op Binary operation type
+    /// \param first Iterator to beginning of range
+    /// \param last Iterator to end of range
+    /// \param init Initial value
+    /// \param op Binary operation used to combine elements
+    /// \return Result of combining init with all elements in range
+    template<class It, class T, class Op = std::plus<>, class = std::enable_if_t<impl::is_circular_array_iterator<It>::value>>
+    [[nodiscard]]
+    T reduce(const It first, const It last, T init, Op op = {}) {
+        aul::for_each_segment(first, last, [&init, &op] (auto p0, auto p1) {
+            init = std::reduce(p0, p1, std::move(init), op);
+        });
+        return init;
+    }
+
     ///
     /// A vector-like container which allows for unused space at both before and
     /// after the elements in the allocation, potentially making insertions
     /// faster compared to std::vector, particularly near the start of the
     /// container.
     ///
+    /// The container may be put into a bounded mode, see set_bounded(), in
+    /// which it behaves as a fixed-capacity ring that overwrites its oldest
+    /// elements rather than growing.
+    ///
+    /// If A is a mirrored allocator, such as aul::Memory_mapped_allocator,
+    /// capacities are rounded to whole pages and the elements are always
+    /// presented as one contiguous range by data() and first_segment(), even
+    /// when they wrap around the end of the allocation.
+    ///
     /// \tparam T Element type
     /// \tparam A Allocator type
-    template<class T, class A = std::allocator<T>>
+    /// \tparam P Capacity policy. Either aul::Arbitrary_capacity or
+    ///     aul::Power_of_two_capacity
+    template<class T, class A = std::allocator<T>, class P = Arbitrary_capacity>
     class Circular_array : public aul::Allocator_aware_base<A> {
         using base = aul::Allocator_aware_base<A>;
     public:
@@ -234,8 +740,30 @@ namespace aul {
         using pointer = typename std::allocator_traits<A>::pointer;
         using const_pointer = typename std::allocator_traits<A>::const_pointer;
 
-        using iterator = Circular_array_iterator<pointer>;
-        using const_iterator = Circular_array_iterator<pointer>;
+    private:
+
+        static constexpr bool is_power_of_two_capacity = std::is_same<P, Power_of_two_capacity>::value;
+
+        static constexpr bool is_mirrored = impl::is_mirrored_allocator<A>::value;
+
+        ///
+        /// Whether growth may resize the current allocation rather than move
+        /// every element into a new one. The allocator relocates elements
+        /// bytewise, so T must be trivially copyable.
+        ///
+        static constexpr bool is_reallocating =
+            impl::is_reallocating_allocator<A>::value &&
+            std::is_trivially_copyable<T>::value &&
+            !is_mirrored;
+
+    public:
+
+        using iterator = typename std::conditional<
+            is_power_of_two_capacity,
+            Masked_circular_array_iterator<pointer>,
+            Circular_array_iterator<pointer>
+        >::type;
+        using const_iterator = iterator;
 
         using reverse_iterator = std::reverse_iterator<iterator>;
         using const_reverse_iterator = std::reverse_iterator<const_iterator>;
@@ -272,11 +800,12 @@ namespace aul {
         /// \param arr Source object to copy from
         Circular_array(const Circular_array& arr):
             base(std::allocator_traits<A>::select_on_container_copy_construction(arr.get_allocator())),
-            allocation(allocate(arr.size())),
-            elem_count(arr.elem_count) {
+            allocation(allocate(arr.bounded ? arr.capacity() : arr.size())),
+            elem_count(arr.elem_count),
+            bounded(arr.bounded) {
 
             auto allocator = get_allocator();
-            aul::uninitialized_copy(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
+            impl::uninitialized_copy_segments(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
         }
 
         ///
@@ -287,25 +816,23 @@ namespace aul {
         /// \param alloc Allocator copy should use
         Circular_array(const Circular_array& arr, const A& alloc):
             base(alloc),
-            allocation(allocate(arr.size())),
-            elem_count(arr.elem_count) {
+            allocation(allocate(arr.bounded ? arr.capacity() : arr.size())),
+            elem_count(arr.elem_count),
+            bounded(arr.bounded) {
 
             auto allocator = get_allocator();
-            aul::uninitialized_copy(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
+            impl::uninitialized_copy_segments(arr.cbegin(), arr.cend(), allocation.ptr, allocator);
         }
 
         ///
         /// Move constructor
         /// \param arr T Object to move resources from
         Circular_array(Circular_array&& arr) noexcept:
-            base(std::move(arr.allocator)),
-            allocation(std::move(allocation)),
-            elem_count(arr.elem_count),
-            head_offset(arr.head_offset) {
-
-            arr.elem_count = 0;
-            arr.head_offset = 0;
-        }
+            base(arr.get_allocator()),
+            allocation(std::exchange(arr.allocation, {})),
+            head_offset(std::exchange(arr.head_offset, 0)),
+            elem_count(std::exchange(arr.elem_count, 0)),
+            bounded(arr.bounded) {}
 
         /// Allocator extended move constructor
         /// \param arr   Object to move resources from
@@ -368,7 +895,7 @@ namespace aul {
             elem_count(std::distance(from, to)) {
 
             auto allocator = get_allocator();
-            aul::uninitialized_copy(from, to, allocation.ptr, allocator);
+            impl::uninitialized_copy_segments(from, to, allocation.ptr, allocator);
         }
 
         ///
@@ -415,6 +942,7 @@ namespace aul {
                 allocation = std::move(rhs.allocation);
                 elem_count = std::exchange(rhs.elem_count, 0);
                 head_offset = std::exchange(rhs.head_offset, 0);
+                bounded = rhs.bounded;
             } else {
                 base::operator=(rhs);
 
@@ -426,6 +954,7 @@ namespace aul {
                 head_offset = 0;
                 rhs.head_offset = 0;
                 elem_count = std::exchange(rhs.elem_count, 0);
+                bounded = rhs.bounded;
             }
             return *this;
         }
@@ -453,6 +982,9 @@ namespace aul {
         ///
         /// Invalidates iterators.
         ///
+        /// In bounded mode, capacity is preserved and std::length_error is
+        /// thrown if the range does not fit.
+        ///
         /// \tparam Iter Forward iterator type
         /// \param a Iterator to beginning of range
         /// \param b Iterator to end of range
@@ -464,11 +996,15 @@ namespace aul {
                 throw std::length_error("aul::Circular_array grew beyond max size");
             }
 
-            auto new_allocation = allocate(range_size);
+            if (bounded && capacity() < static_cast<size_type>(range_size)) {
+                throw std::length_error("aul::Circular_array in bounded mode cannot grow");
+            }
+
+            auto new_allocation = allocate(bounded ? capacity() : range_size);
 
             auto allocator = get_allocator();
             try {
-                aul::uninitialized_copy(a, b, new_allocation.ptr, allocator);
+                impl::uninitialized_copy_segments(a, b, new_allocation.ptr, allocator);
             } catch (...) {
                 deallocate(new_allocation);
                 throw;
@@ -501,11 +1037,18 @@ namespace aul {
         ///
         /// Invalidates iterators.
         ///
+        /// In bounded mode, capacity is preserved and std::length_error is
+        /// thrown if n elements do not fit.
+        ///
         /// \param n   Number of elements to fill container with
         /// \param val Value to fill container with
         void assign(const size_type n, const T& val) {
+            if (bounded && capacity() < n) {
+                throw std::length_error("aul::Circular_array in bounded mode cannot grow");
+            }
+
             auto allocator = get_allocator();
-            auto new_allocation = allocate(n);
+            auto new_allocation = allocate(bounded ? capacity() : n);
 
             try {
                 aul::uninitialized_fill_n(new_allocation.ptr, n, val, allocator);
@@ -528,12 +1071,12 @@ namespace aul {
         ///
         /// \return Iterator to beginning of element range.
         iterator begin() {
-            bool c = is_segmented();
-            return iterator{
-                difference_type(head_offset - c * allocation.capacity),
-                allocation.ptr,
-                allocation.ptr + allocation.capacity
-            };
+            if constexpr (is_power_of_two_capacity) {
+                return make_iterator(head_offset, allocation);
+            } else {
+                bool c = is_segmented();
+                return make_iterator(difference_type(head_offset - c * allocation.capacity), allocation);
+            }
         }
 
         ///
@@ -551,12 +1094,7 @@ namespace aul {
         ///
         /// \return Iterator to end of element range.
         iterator end() {
-            bool c = is_segmented();
-            return iterator{
-                difference_type(head_offset - c * capacity() + size()),
-                allocation.ptr,
-                allocation.ptr + capacity()
-            };
+            return begin() + difference_type(size());
         }
 
         ///
@@ -640,7 +1178,7 @@ namespace aul {
         ///
         /// \return Const reference to last element
         const T& back() const {
-            return *index_to_ptr(elem_count);
+            return *index_to_ptr(elem_count - 1);
         }
 
         ///
@@ -707,6 +1245,8 @@ namespace aul {
 
             if (elem_count < allocation.capacity) {
                 return emplace_within_capacity(it, std::forward<Args>(args)...);
+            } else if (bounded) {
+                throw std::length_error("aul::Circular_array in bounded mode cannot grow");
             } else {
                 return emplace_with_new_allocation(it, std::forward<Args>(args)...);
             }
@@ -741,12 +1281,19 @@ namespace aul {
         /// \return Iterator to first of newly created elements
         iterator insert(const_iterator pos, const size_type n, const T& val) {
             iterator it = begin() + (pos - cbegin());
+            if (n == 0) {
+                return it;
+            }
 
             if (max_size() -  n < size()) {
                 throw std::length_error("Circular_array grew too big");
             }
 
-            if (elem_count + n < allocation.capacity) {
+            if (bounded && allocation.capacity - elem_count < n) {
+                throw std::length_error("aul::Circular_array in bounded mode cannot grow");
+            }
+
+            if (elem_count + n <= allocation.capacity) {
                 return insert_within_capacity_n(it, n, val);
             } else {
                 return insert_with_new_allocation_n(it, n, val);
@@ -764,14 +1311,22 @@ namespace aul {
         /// \return Iterator to first of newly inserted elements
         template<class Iter>
         iterator insert(const_iterator pos, Iter from, Iter to) {
-            auto d = std::distance(to, from);
+            auto d = std::distance(from, to);
 
             if (max_size() - d < elem_count) {
                 throw std::runtime_error("Circular_array grew beyond max size");
             }
 
+            if (bounded && allocation.capacity - elem_count < static_cast<size_type>(d)) {
+                throw std::length_error("aul::Circular_array in bounded mode cannot grow");
+            }
+
             iterator it = begin() + (pos - cbegin());
-            if (elem_count + d < capacity()) {
+            if (d == 0) {
+                return it;
+            }
+
+            if (elem_count + d <= capacity()) {
                 return insert_within_capacity(it, from, to, d);
             } else {
                 return insert_with_new_allocation(it, from, to, d);
@@ -793,7 +1348,13 @@ namespace aul {
         /// Constructs a new element as the new first element in the array using
         /// the specified parameters.
         ///
-        /// Provides strong-exception guarantee.
+        /// Provides strong-exception guarantee, except in bounded mode.
+        ///
+        /// In bounded mode, if the container is full, the last element is
+        /// overwritten instead. The last element is destroyed before the new
+        /// element is constructed, so if the constructor throws, the container
+        /// is left one element shorter. Only the basic exception guarantee is
+        /// provided in that case.
         ///
         /// \tparam Args Types taken by object constructor
         /// \param args Arguments to constructor of new object
@@ -805,6 +1366,8 @@ namespace aul {
 
             if (elem_count < allocation.capacity) {
                 emplace_front_within_capacity(std::forward<Args>(args)...);
+            } else if (bounded) {
+                emplace_front_overwriting(std::forward<Args>(args)...);
             } else {
                 emplace_front_with_new_allocation(std::forward<Args>(args)...);
             }
@@ -830,7 +1393,13 @@ namespace aul {
         /// Constructs a new element at the end of the logical array using the
         /// specified parameters.
         ///
-        /// Provides strong-exception guarantee
+        /// Provides strong-exception guarantee, except in bounded mode.
+        ///
+        /// In bounded mode, if the container is full, the first element is
+        /// overwritten instead. The first element is destroyed before the new
+        /// element is constructed, so if the constructor throws, the container
+        /// is left one element shorter. Only the basic exception guarantee is
+        /// provided in that case.
         ///
         /// \tparam Args Parameter types for new element's constructor
         /// \param args Parameter types for new element's constructor
@@ -842,6 +1411,8 @@ namespace aul {
 
             if (size() < capacity()) {
                 emplace_back_within_capacity(std::forward<Args>(args)...);
+            } else if (bounded) {
+                emplace_back_overwriting(std::forward<Args>(args)...);
             } else {
                 emplace_back_with_new_allocation(std::forward<Args>(args)...);
             }
@@ -934,6 +1505,10 @@ namespace aul {
         /// \param from Iterator to beginning of range
         /// \param to Iterator to end of range
         void erase(const_iterator from, const_iterator to) {
+            if (from == to) {
+                return;
+            }
+
             size_type left = from - begin();
             size_type right = cend() - to;
 
@@ -957,6 +1532,9 @@ namespace aul {
         /// Ensure that the backing allocation holds enough space to store the
         /// specified number of elements
         ///
+        /// This is the means by which the capacity of a bounded container is
+        /// increased
+        ///
         /// Invalidates iterators
         ///
         /// \param n Number of elements to reserve space for
@@ -969,9 +1547,17 @@ namespace aul {
                 throw std::length_error("aul::Circular_array::reserve() called with excessive allocation size");
             }
 
+            if constexpr (is_reallocating) {
+                if (capacity() < n) {
+                    reallocate(n);
+                    return;
+                }
+            }
+
             auto allocator = get_allocator();
             allocation_type new_allocation = allocate(n);
             aul::uninitialized_move(begin(), end(), new_allocation.ptr, allocator);
+            aul::destroy(begin(), end(), allocator);
 
             deallocate(allocation);
             allocation = new_allocation;
@@ -987,6 +1573,79 @@ namespace aul {
             std::swap(allocation, other.allocation);
             std::swap(elem_count, other.elem_count);
             std::swap(head_offset, other.head_offset);
+            std::swap(bounded, other.bounded);
+        }
+
+        ///
+        /// Enables or disables bounded mode. While bounded, the container
+        /// never grows its allocation on its own: push_back() and
+        /// emplace_back() on a full container overwrite the first element,
+        /// push_front() and emplace_front() overwrite the last element, and
+        /// other insertions which do not fit throw std::length_error. Only
+        /// reserve() changes the capacity.
+        ///
+        /// Use reserve() beforehand to choose the bound.
+        ///
+        /// \param b True to enable bounded mode. False to disable it
+        void set_bounded(const bool b) noexcept {
+            bounded = b;
+        }
+
+        ///
+        /// Rearranges the elements in place so that they occupy one contiguous
+        /// range, starting at data(). Capacity is unchanged and no allocation
+        /// is made unless moving an element may throw, in which case the
+        /// elements are moved to a new allocation of the same capacity and
+        /// the strong exception guarantee is provided.
+        ///
+        /// Invalidates iterators
+        ///
+        void linearize() {
+            if (is_mirrored || !is_segmented()) {
+                return;
+            }
+
+            constexpr bool is_nothrow_relocatable =
+                std::is_nothrow_move_constructible<T>::value &&
+                std::is_nothrow_move_assignable<T>::value;
+
+            auto allocator = get_allocator();
+
+            if constexpr (is_nothrow_relocatable) {
+                const difference_type a = difference_type(capacity()) - head_offset;
+                const difference_type b = difference_type(size()) - a;
+                const difference_type gap = difference_type(capacity() - size());
+
+                pointer p = allocation.ptr;
+                if (b <= a) {
+                    //Close gap by moving second segment right, then swap segments
+                    if (gap != 0) {
+                        aul::uninitialized_destructive_move_elements_right(p, p + b, p + b + gap, allocator);
+                    }
+                    std::rotate(p + gap, p + gap + b, p + capacity());
+                    head_offset = gap;
+                } else {
+                    //Close gap by moving first segment left, then swap segments
+                    if (gap != 0) {
+                        aul::uninitialized_destructive_move_elements_left(p + b, p + head_offset, p + capacity(), allocator);
+                    }
+                    std::rotate(p, p + b, p + b + a);
+                    head_offset = 0;
+                }
+            } else {
+                allocation_type new_allocation = allocate(capacity());
+                try {
+                    aul::uninitialized_move(begin(), end(), new_allocation.ptr, allocator);
+                } catch (...) {
+                    deallocate(new_allocation);
+                    throw;
+                }
+
+                aul::destroy(begin(), end(), allocator);
+                deallocate(allocation);
+                allocation = new_allocation;
+                head_offset = 0;
+            }
         }
 
         //=================================================
@@ -1022,7 +1681,17 @@ namespace aul {
             auto allocator = get_allocator();
             const size_type max_allocation = std::allocator_traits<A>::max_size(allocator);
 
-            return std::min(max_allocation, type_max);
+            const size_type ret = std::min(max_allocation, type_max);
+            if constexpr (is_power_of_two_capacity) {
+                //Largest power of two not greater than ret
+                size_type p = 1;
+                while (p <= ret / 2) {
+                    p *= 2;
+                }
+                return p;
+            } else {
+                return ret;
+            }
         }
 
         ///
@@ -1040,25 +1709,74 @@ namespace aul {
             return base::get_allocator();
         }
 
-        /*
         ///
-        /// \return
+        /// \return True if the container is in bounded mode
         [[nodiscard]]
-        std::tuple<pointer, pointer, pointer, pointer> data() {
-            const auto segment0 = first_segment();
-            const auto segment1 = second_segment();
-            return {segment0.first, segment0.second, segment1.first, segment1.second};
+        bool is_bounded() const noexcept {
+            return bounded;
         }
 
+        //=================================================
+        // Contiguous access
+        //=================================================
+
         ///
-        /// \return
+        /// The elements are only contiguous if second_segment() is empty,
+        /// which is always the case after a call to linearize() or with a
+        /// mirrored allocator.
+        ///
+        /// \return Pointer to first element
+        [[nodiscard]]
+        pointer data() noexcept {
+            return allocation.ptr + head_offset;
+        }
+
+        ///
+        /// The elements are only contiguous if second_segment() is empty,
+        /// which is always the case after a call to linearize() or with a
+        /// mirrored allocator.
+        ///
+        /// \return Pointer to first element
+        [[nodiscard]]
+        const_pointer data() const noexcept {
+            return allocation.ptr + head_offset;
+        }
+
+        ///
+        /// \return View over the elements from the first element up to either
+        ///     the last element or the end of the allocation, whichever comes
+        ///     first. Always all elements with a mirrored allocator
+        [[nodiscard]]
+        aul::Span<T> first_segment() noexcept {
+            return aul::Span<T>{first_segment_size(), data()};
+        }
+
+        ///
+        /// \return View over the elements from the first element up to either
+        ///     the last element or the end of the allocation, whichever comes
+        ///     first. Always all elements with a mirrored allocator
+        [[nodiscard]]
+        aul::Span<const T> first_segment() const noexcept {
+            return aul::Span<const T>{first_segment_size(), data()};
+        }
+
+        ///
+        /// \return View over the elements which wrapped around to the start
+        ///     of the allocation. Empty if there are none, or with a mirrored
+        ///     allocator
+        [[nodiscard]]
+        aul::Span<T> second_segment() noexcept {
+            return aul::Span<T>{size() - first_segment_size(), allocation.ptr};
+        }
+
+        ///
+        /// \return View over the elements which wrapped around to the start
+        ///     of the allocation. Empty if there are none, or with a mirrored
+        ///     allocator
         [[nodiscard]]
-        std::tuple<const_pointer, const_pointer, const_pointer, const_pointer> data() const {
-            const auto segment0 = first_segment();
-            const auto segment1 = second_segment();
-            return {segment0.first, segment0.second, segment1.first, segment1.second};
+        aul::Span<const T> second_segment() const noexcept {
+            return aul::Span<const T>{size() - first_segment_size(), allocation.ptr};
         }
-        */
 
         //=================================================
         // Misc. methods
@@ -1100,6 +1818,11 @@ namespace aul {
         ///
         size_type elem_count{};
 
+        ///
+        /// Whether the container is in bounded mode
+        ///
+        bool bounded = false;
+
         //=================================================
         // Helper functions
         //=================================================
@@ -1108,6 +1831,15 @@ namespace aul {
         /// \param n Index of object to get pointer to
         /// \return Pointer to nth element
         pointer index_to_ptr(const size_type n) const {
+            if constexpr (is_power_of_two_capacity) {
+                return allocation.ptr + ((head_offset + n) & (allocation.capacity - 1));
+            }
+
+            if constexpr (is_mirrored) {
+                //Positions past the end of the allocation fall in its mirror
+                return allocation.ptr + (head_offset + n);
+            }
+
             size_type index = 0;
 
             if (n < allocation.capacity - head_offset) {
@@ -1130,6 +1862,45 @@ namespace aul {
             }
         }
 
+        ///
+        /// \param n Requested capacity
+        /// \return Capacity of allocation to make under capacity policy
+        [[nodiscard]]
+        size_type round_capacity(const size_type n) const {
+            size_type ret = n;
+
+            if constexpr (is_power_of_two_capacity) {
+                if (max_size() < n) {
+                    throw std::length_error("aul::Circular_array grew beyond max size");
+                }
+
+                ret = (n == 0) ? 0 : 1;
+                while (ret < n) {
+                    ret *= 2;
+                }
+            }
+
+            if constexpr (is_mirrored) {
+                //The mirror must begin exactly at the end of the allocation
+                ret = A::round_size(ret);
+            }
+
+            return ret;
+        }
+
+        ///
+        /// \param offset Offset in iterator's coordinates
+        /// \param alloc Allocation iterator should refer to
+        /// \return Iterator into alloc
+        [[nodiscard]]
+        iterator make_iterator(const difference_type offset, const allocation_type& alloc) const {
+            if constexpr (is_power_of_two_capacity) {
+                return iterator{offset, alloc.ptr, static_cast<size_type>(alloc.capacity - 1)};
+            } else {
+                return iterator{offset, alloc.ptr, alloc.ptr + alloc.capacity};
+            }
+        }
+
         //=================================================
         // Meta helpers
         //=================================================
@@ -1143,54 +1914,17 @@ namespace aul {
             return s > (capacity() - head_offset);
         }
 
-        /*
         ///
-        /// \return
+        /// \return Number of elements in the first segment
         [[nodiscard]]
-        std::pair<pointer, pointer> first_segment() {
-            if (is_segmented()) {
-                return {allocation.ptr + head_offset, allocation.ptr + capacity()};
-            }
-            else {
-                return {allocation.ptr + head_offset, allocation.ptr + head_offset + size()};
-            };
-        }
-
-        [[nodiscard]]
-        std::pair<const_pointer, const_pointer> first_segment() const {
-            if (is_segmented()) {
-                return {allocation.ptr + head_offset, allocation.ptr + capacity()};
-            }
-            else {
-                return {allocation.ptr + head_offset, allocation.ptr + head_offset + size()};
-            };
-        }
-        [[nodiscard]]
-        std::pair<pointer, pointer> second_segment() {
-            if (is_segmented()) {
-                return {
-                    allocation.ptr,
-                    allocation.ptr + head_offset - capacity() + size()
-                };
+        size_type first_segment_size() const noexcept {
+            if constexpr (is_mirrored) {
+                return size();
             } else {
-                return {pointer{}, pointer{}};
+                return std::min(size(), size_type(capacity() - head_offset));
             }
         }
 
-        [[nodiscard]]
-        std::pair<const_pointer, const_pointer> second_segment() const {
-            if (is_segmented()) {
-                return {
-                    allocation.ptr,
-                    allocation.ptr + head_offset - capacity() + size()
-                };
-            }
-            else {
-                return { pointer{}, pointer{} };
-            }
-        }
-        */
-
         //=================================================
         // Allocation methods
         //=================================================
@@ -1201,8 +1935,9 @@ namespace aul {
 
             try {
                 auto allocator = get_allocator();
-                alloc.ptr = std::allocator_traits<allocator_type>::allocate(allocator, n);
-                alloc.capacity = n;
+                const size_type m = round_capacity(n);
+                alloc.ptr = std::allocator_traits<allocator_type>::allocate(allocator, m);
+                alloc.capacity = m;
             } catch (...) {
                 alloc = {};
                 throw;
@@ -1217,8 +1952,9 @@ namespace aul {
 
             try {
                 auto allocator = get_allocator();
-                alloc.ptr = std::allocator_traits<allocator_type>::allocate(allocator, n, hint.ptr);
-                alloc.capacity = n;
+                const size_type m = round_capacity(n);
+                alloc.ptr = std::allocator_traits<allocator_type>::allocate(allocator, m, hint.ptr);
+                alloc.capacity = m;
             } catch (...) {
                 alloc = {};
                 throw;
@@ -1233,6 +1969,44 @@ namespace aul {
             alloc = {};
         }
 
+        ///
+        /// Grows the current allocation through the allocator's reallocate().
+        /// The allocator preserves the allocation's contents, so only one of
+        /// the two segments needs to be relocated to close the gap left by
+        /// the new capacity, and the smaller one is chosen.
+        ///
+        /// Only used if is_reallocating is true.
+        ///
+        /// \param n Minimum capacity of resized allocation. Must exceed the
+        ///     current capacity
+        void reallocate(const size_type n) {
+            auto allocator = get_allocator();
+
+            const size_type old_capacity = allocation.capacity;
+            const size_type new_capacity = round_capacity(n);
+
+            const size_type first_size = first_segment_size();
+            const size_type second_size = elem_count - first_size;
+
+            pointer p = allocator.reallocate(allocation.ptr, old_capacity, new_capacity);
+            allocation.ptr = p;
+            allocation.capacity = new_capacity;
+
+            if (second_size == 0) {
+                return;
+            }
+
+            if (second_size <= first_size && old_capacity + second_size <= new_capacity) {
+                //Append the wrapped segment to the first
+                std::memcpy(p + old_capacity, p, second_size * sizeof(T));
+            } else {
+                //Move the first segment to the end of the allocation
+                const difference_type new_head_offset = new_capacity - first_size;
+                std::memmove(p + new_head_offset, p + head_offset, first_size * sizeof(T));
+                head_offset = new_head_offset;
+            }
+        }
+
         //=================================================
         // Element construction/destruction
         //=================================================
@@ -1277,37 +2051,32 @@ namespace aul {
         template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
         iterator insert_within_capacity_nudge_left(iterator pos, Iter a, Iter b, Diff_type d) {
             auto allocator = get_allocator();
+            const difference_type i = pos - begin();
 
-            iterator w{
-                difference_type(head_offset - is_segmented() * allocation.capacity - d),
-                allocation.ptr,
-                allocation.ptr + allocation.capacity
-            };
-
+            iterator w = begin() - d;
             iterator x = begin();
-            iterator y = pos + 1;
 
             // Move elements left to make room for new elements
             iterator z = aul::uninitialized_destructive_move_elements_left(
-                w, x, y, allocator
+                w, x, pos, allocator
             );
 
             // Try to construct new elements
             try {
-                aul::uninitialized_copy_n(a, d, z, allocator);
+                impl::uninitialized_copy_segments(a, b, z, allocator);
             } catch (...) {
                 //Move elements back to original positions
                 aul::uninitialized_destructive_move_elements_right(
-                    w, x, y, allocator
+                    w, z, pos, allocator
                 );
 
                 throw;
             }
 
-            head_offset -= d;
+            decrease_head_offset(d);
             elem_count += d;
 
-            return z;
+            return begin() + i;
         }
 
         ///
@@ -1327,28 +2096,27 @@ namespace aul {
         template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
         iterator insert_within_capacity_nudge_right(iterator pos, Iter a, Iter b, Diff_type d) {
             auto allocator = get_allocator();
+            const difference_type i = pos - begin();
 
-            iterator w = pos;
             iterator x = end();
             iterator y = end() + d;
 
             iterator z = aul::uninitialized_destructive_move_elements_right(
-                w, x, y, allocator
+                pos, x, y, allocator
             );
 
             try {
-                aul::uninitialized_copy_n(a, d, pos, allocator);
+                impl::uninitialized_copy_segments(a, b, pos, allocator);
             } catch (...) {
                 // Move elements back
-                aul::uninitialized_destructive_move_elements_left(w, z, y, allocator);
+                aul::uninitialized_destructive_move_elements_left(pos, z, y, allocator);
 
                 throw;
             }
 
-            head_offset -= d;
             elem_count += d;
 
-            return pos;
+            return begin() + i;
         }
 
         ///
@@ -1366,23 +2134,28 @@ namespace aul {
         /// \return Iterator to first newly inserted element
         template<class Iter, class Diff_type = typename std::iterator_traits<Iter>::difference_type>
         iterator insert_with_new_allocation(iterator pos, Iter a, Iter b, Diff_type d) {
+            if constexpr (is_reallocating) {
+                const difference_type i = pos - begin();
+                reallocate(grow_size(elem_count + d));
+                return insert_within_capacity(begin() + i, a, b, d);
+            }
+
             auto allocator = get_allocator();
 
             auto new_capacity = grow_size(elem_count + d);
             auto new_allocation = allocate(new_capacity);
 
-            pointer p1{};
-            auto o = pos - begin();
+            const difference_type o = pos - begin();
+            pointer p = new_allocation.ptr + o;
             try {
-                auto p = new_allocation.ptr + o;
-                p1 = aul::uninitialized_copy(a, b, p, allocator);
+                impl::uninitialized_copy_segments(a, b, p, allocator);
             } catch (...) {
                 deallocate(new_allocation);
                 throw;
             }
 
-            aul::uninitialized_move(begin(), pos, new_allocation, allocator);
-            aul::uninitialized_move(pos, end(), p1, allocator);
+            aul::uninitialized_move(begin(), pos, new_allocation.ptr, allocator);
+            aul::uninitialized_move(pos, end(), p + d, allocator);
 
             aul::destroy(begin(), end(), allocator);
             deallocate(allocation);
@@ -1392,7 +2165,7 @@ namespace aul {
             elem_count += d;
             head_offset = 0;
 
-            return {o, allocation.ptr, allocation.ptr + allocation.capacity};
+            return begin() + o;
         }
 
         ///
@@ -1417,6 +2190,14 @@ namespace aul {
 
         template<class...Args>
         void emplace_front_with_new_allocation(Args&&...args) {
+            if constexpr (is_reallocating) {
+                //Arguments may refer to elements that are about to move
+                value_type tmp(std::forward<Args>(args)...);
+                reallocate(grow_size(elem_count + 1));
+                emplace_front_within_capacity(std::move(tmp));
+                return;
+            }
+
             auto new_capacity = grow_size(elem_count + 1);
             auto new_allocation = allocate(new_capacity);
 
@@ -1462,6 +2243,14 @@ namespace aul {
 
         template<class...Args>
         void emplace_back_with_new_allocation(Args&&...args) {
+            if constexpr (is_reallocating) {
+                //Arguments may refer to elements that are about to move
+                value_type tmp(std::forward<Args>(args)...);
+                reallocate(grow_size(elem_count + 1));
+                emplace_back_within_capacity(std::move(tmp));
+                return;
+            }
+
             size_type new_capacity = grow_size(elem_count + 1);
             allocation_type new_allocation = allocate(new_capacity);
 
@@ -1487,6 +2276,40 @@ namespace aul {
             ++elem_count;
         }
 
+        ///
+        /// Replaces the first element with a new last element under the
+        /// assumption that the container is bounded and full. The new element
+        /// is constructed in the slot the first element occupied.
+        ///
+        /// \tparam Args Types of arguments to constructor
+        /// \param args Arguments to constructor
+        template<class...Args>
+        void emplace_back_overwriting(Args&&...args) {
+            if (capacity() == 0) {
+                throw std::length_error("aul::Circular_array in bounded mode has no capacity");
+            }
+
+            pop_front();
+            emplace_back_within_capacity(std::forward<Args>(args)...);
+        }
+
+        ///
+        /// Replaces the last element with a new first element under the
+        /// assumption that the container is bounded and full. The new element
+        /// is constructed in the slot the last element occupied.
+        ///
+        /// \tparam Args Types of arguments to constructor
+        /// \param args Arguments to constructor
+        template<class...Args>
+        void emplace_front_overwriting(Args&&...args) {
+            if (capacity() == 0) {
+                throw std::length_error("aul::Circular_array in bounded mode has no capacity");
+            }
+
+            pop_back();
+            emplace_front_within_capacity(std::forward<Args>(args)...);
+        }
+
         ///
         /// Emplaces a new element under the assumption that size() < capacity()
         ///
@@ -1514,14 +2337,14 @@ namespace aul {
         template<class...Args>
         iterator emplace_within_capacity_nudge_left(iterator it, Args&&...args) {
             auto allocator = get_allocator();
+            const difference_type i = it - begin();
 
             auto it0 = begin() - 1;
             auto it1 = begin();
-            auto it2 = it + 1;
 
-            auto it3 = aul::uninitialized_destructive_move_elements_left(it0, it1, it2, allocator);
+            auto it3 = aul::uninitialized_destructive_move_elements_left(it0, it1, it, allocator);
 
-            pointer p = std::addressof(it[-1]);
+            pointer p = std::addressof(*it3);
             try {
                 std::allocator_traits<allocator_type>::construct(
                     allocator,
@@ -1536,7 +2359,7 @@ namespace aul {
             decrement_head_offset();
             ++elem_count;
 
-            return it - 1;
+            return begin() + i;
         }
 
         ///
@@ -1547,6 +2370,7 @@ namespace aul {
         template<class...Args>
         iterator emplace_within_capacity_nudge_right(iterator it, Args&&...args) {
             auto allocator = get_allocator();
+            const difference_type i = it - begin();
 
             auto it0 = it;
             auto it1 = end();
@@ -1567,7 +2391,7 @@ namespace aul {
             }
 
             ++elem_count;
-            return it;
+            return begin() + i;
         }
 
         iterator insert_within_capacity_n(iterator it, size_type n, const T& val) {
@@ -1582,15 +2406,15 @@ namespace aul {
 
         iterator insert_within_capacity_nudge_left_n(iterator it, size_type n, const T& val) {
             auto allocator = get_allocator();
+            const difference_type i = it - begin();
 
             auto it0 = begin() - n;
             auto it1 = begin();
-            auto it2 = it + 1;
 
-            auto it3 = aul::uninitialized_destructive_move_elements_left(it0, it1, it2, allocator);
+            auto it3 = aul::uninitialized_destructive_move_elements_left(it0, it1, it, allocator);
 
             try {
-                aul::uninitialized_fill_n(it - n, n, val, allocator);
+                aul::uninitialized_fill_n(it3, n, val, allocator);
             } catch(...) {
                 aul::uninitialized_destructive_move_elements_right(it0, it3, it, allocator);
                 throw;
@@ -1599,11 +2423,12 @@ namespace aul {
             decrease_head_offset(n);
             elem_count += n;
 
-            return (it - n);
+            return begin() + i;
         }
 
         iterator insert_within_capacity_nudge_right_n(iterator it, size_type n, const T& val) {
             auto allocator = get_allocator();
+            const difference_type i = it - begin();
 
             auto it0 = it;
             auto it1 = end();
@@ -1619,15 +2444,25 @@ namespace aul {
             }
 
             elem_count += n;
-            return it;
+            return begin() + i;
         }
 
         iterator insert_with_new_allocation_n(iterator it, size_type n, const T& val) {
-            allocation_type new_allocation = allocate(size() + n);
+            if constexpr (is_reallocating) {
+                //val may refer to an element that is about to move
+                const value_type tmp = val;
+                const difference_type i = it - begin();
+                reallocate(grow_size(elem_count + n));
+                return insert_within_capacity_n(begin() + i, n, tmp);
+            }
 
             auto allocator = get_allocator();
 
-            pointer p = new_allocation.ptr + (it - begin());
+            auto new_capacity = grow_size(elem_count + n);
+            auto new_allocation = allocate(new_capacity);
+
+            const difference_type o = it - begin();
+            pointer p = new_allocation.ptr + o;
             try {
                 aul::uninitialized_fill_n(p, n, val, allocator);
             } catch (...) {
@@ -1635,13 +2470,18 @@ namespace aul {
                 throw;
             }
 
-            aul::uninitialized_move(begin(), it, allocation.ptr, allocator);
+            aul::uninitialized_move(begin(), it, new_allocation.ptr, allocator);
             aul::uninitialized_move(it, end(), p + n, allocator);
+
+            aul::destroy(begin(), end(), allocator);
+            deallocate(allocation);
+
+            allocation = new_allocation;
+
             elem_count += n;
             head_offset = 0;
 
-            allocation = new_allocation;
-            return {it - begin(), allocation.ptr, allocation.ptr + allocation.capacity};
+            return begin() + o;
         }
 
         ///
@@ -1654,15 +2494,19 @@ namespace aul {
         /// \param args Parameters for new element's constructor
         template<class...Args>
         iterator emplace_with_new_allocation(iterator it, Args&&...args) {
+            if constexpr (is_reallocating) {
+                //Arguments may refer to elements that are about to move
+                value_type tmp(std::forward<Args>(args)...);
+                const difference_type i = it - begin();
+                reallocate(grow_size(elem_count + 1));
+                return emplace_within_capacity(begin() + i, std::move(tmp));
+            }
+
             size_type new_capacity = grow_size(elem_count + 1);
             allocation_type new_allocation = allocate(new_capacity);
 
             //The pointers in this iterator may need to be laundered
-            iterator ret{
-                it - begin(),
-                new_allocation.ptr,
-                new_allocation.ptr + new_allocation.capacity
-            };
+            iterator ret = make_iterator(it - begin(), new_allocation);
 
             auto allocator = get_allocator();
             pointer p = std::addressof(*ret);
@@ -1694,6 +2538,11 @@ namespace aul {
         }
 
         void increment_head_offset() {
+            if constexpr (is_power_of_two_capacity) {
+                head_offset = (head_offset + 1) & (allocation.capacity - 1);
+                return;
+            }
+
             head_offset += 1;
             if (head_offset == allocation.capacity) {
                 head_offset = 0;
@@ -1701,6 +2550,11 @@ namespace aul {
         }
 
         void decrement_head_offset() {
+            if constexpr (is_power_of_two_capacity) {
+                head_offset = (head_offset - 1) & (allocation.capacity - 1);
+                return;
+            }
+
             if (head_offset == 0) {
                 head_offset = (allocation.capacity - 1);
             } else {
@@ -1708,23 +2562,17 @@ namespace aul {
             }
         }
 
-        void increase_head_offset(size_type d) {
-            d %= elem_count;
-
-            if (head_offset < elem_count - d) {
-                head_offset += d;
-            } else {
-                head_offset = head_offset - size() + d;
+        void increase_head_offset(const size_type d) {
+            head_offset += d;
+            if (head_offset >= difference_type(allocation.capacity)) {
+                head_offset -= allocation.capacity;
             }
         }
 
-        void decrease_head_offset(size_type d) {
-            d %= elem_count;
-
-            if (d < head_offset) {
-                head_offset -= d;
-            } else {
-                head_offset += elem_count - d;
+        void decrease_head_offset(const size_type d) {
+            head_offset -= d;
+            if (head_offset < 0) {
+                head_offset += allocation.capacity;
             }
         }
 
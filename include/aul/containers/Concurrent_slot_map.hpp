@@ -0,0 +1,619 @@
+#ifndef AUL_CONCURRENT_SLOT_MAP_HPP
+#define AUL_CONCURRENT_SLOT_MAP_HPP
+
+#include "Slot_map.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace aul {
+
+    ///
+    /// A thread-safe counterpart to aul::Slot_map.
+    ///
+    /// Keys are the same aul::Slot_map_key objects that aul::Slot_map uses,
+    /// but elements are not kept in a dense array. Instead, each key's index
+    /// identifies a slot which holds the element along with its version.
+    /// Slots live in chunks whose sizes double as the container grows. Chunks
+    /// are never reallocated so growth never moves live elements, and
+    /// references to elements remain valid until those elements are erased.
+    ///
+    /// A slot's version is odd while it holds an element and even while it's
+    /// free. Looking up a key is wait-free and consists of an acquire load of
+    /// the chunk pointer and of the slot's version.
+    ///
+    /// Free slots are kept on shard_count independent free lists rather than
+    /// on one list per thread, since a container cannot cheaply track or
+    /// reclaim state for threads that come and go. Each list is guarded by its
+    /// own mutex and sits on its own cache line. A thread is assigned to a list
+    /// by hashing its id, so threads on different lists do not contend when
+    /// inserting or erasing, while threads that hash to the same list share its
+    /// lock. A thread whose list is empty tries the others without blocking
+    /// before taking a fresh slot, so freed slots are not stranded on lists of
+    /// threads which no longer insert.
+    ///
+    /// emplace(), erase(), and all lookup functions may be called
+    /// concurrently. However, erasing an element while another thread is
+    /// accessing that same element is undefined behavior. Unlike
+    /// aul::Slot_map, this container cannot be iterated over.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class Concurrent_slot_map {
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        class Slot;
+
+        class alignas(64) Shard;
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+    public:
+
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using value_type = T;
+        using key_type = Slot_map_key<size_type>;
+
+        using reference = T&;
+        using const_reference = const T&;
+
+    private:
+
+        using slot_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Slot>;
+        using slot_allocator_traits = std::allocator_traits<slot_allocator_type>;
+        using slot_pointer = typename slot_allocator_traits::pointer;
+
+        //=================================================
+        // Static constants
+        //=================================================
+
+    public:
+
+        ///
+        /// Number of slots in the first chunk. Each subsequent chunk holds
+        /// twice as many slots as the previous one.
+        ///
+        static constexpr size_type base_chunk_size = 64;
+
+        ///
+        /// Number of independent free lists. More lists make it less likely
+        /// that concurrent threads share one, at the cost of a longer search
+        /// when a thread's own list is empty
+        ///
+        static constexpr size_type shard_count = 16;
+
+    private:
+
+        static constexpr size_type base_chunk_shift = 6;
+
+        static constexpr size_type max_chunk_count = std::numeric_limits<size_type>::digits - base_chunk_shift;
+
+        static constexpr size_type null_index = std::numeric_limits<size_type>::max();
+
+        static_assert(base_chunk_size == (size_type{1} << base_chunk_shift));
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        ///
+        /// Default constructor
+        ///
+        Concurrent_slot_map() noexcept(noexcept(allocator_type{})) = default;
+
+        ///
+        /// \param alloc Allocator to copy-construct internal allocators from
+        ///
+        explicit Concurrent_slot_map(const allocator_type& alloc):
+            allocator(alloc) {}
+
+        Concurrent_slot_map(const Concurrent_slot_map&) = delete;
+        Concurrent_slot_map(Concurrent_slot_map&&) = delete;
+
+        ///
+        /// Destructor. Must not run concurrently with any other member
+        /// function.
+        ///
+        ~Concurrent_slot_map() {
+            slot_allocator_type slot_allocator{allocator};
+
+            for (size_type k = 0; k != max_chunk_count; ++k) {
+                Slot* chunk = chunks[k].load(std::memory_order_acquire);
+                if (!chunk) {
+                    continue;
+                }
+
+                const size_type n = chunk_size(k);
+                for (size_type i = 0; i != n; ++i) {
+                    if (chunk[i].version.load(std::memory_order_relaxed) & 1) {
+                        std::allocator_traits<A>::destroy(allocator, chunk[i].element());
+                    }
+                }
+
+                aul::destroy(chunk, chunk + n, slot_allocator);
+                slot_allocator_traits::deallocate(
+                    slot_allocator,
+                    std::pointer_traits<slot_pointer>::pointer_to(*chunk),
+                    n
+                );
+            }
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Concurrent_slot_map& operator=(const Concurrent_slot_map&) = delete;
+        Concurrent_slot_map& operator=(Concurrent_slot_map&&) = delete;
+
+        //=================================================
+        // Element access operators/methods
+        //=================================================
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        [[nodiscard]]
+        T& operator[](const key_type key) noexcept {
+            return *slot_at(key.index)->element();
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        [[nodiscard]]
+        const T& operator[](const key_type key) const noexcept {
+            return *slot_at(key.index)->element();
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        ///
+        [[nodiscard]]
+        T& at(const key_type key) {
+            T* ptr = find(key);
+            if (!ptr) {
+                throw std::runtime_error("aul::Concurrent_slot_map::at() called with invalid key");
+            }
+
+            return *ptr;
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Reference to element mapped to key
+        ///
+        [[nodiscard]]
+        const T& at(const key_type key) const {
+            const T* ptr = find(key);
+            if (!ptr) {
+                throw std::runtime_error("aul::Concurrent_slot_map::at() called with invalid key");
+            }
+
+            return *ptr;
+        }
+
+        ///
+        /// Wait-free.
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Pointer to element mapped to key. nullptr if key is not
+        ///     valid
+        [[nodiscard]]
+        T* find(const key_type key) noexcept {
+            Slot* slot = checked_slot_at(key);
+            return slot ? slot->element() : nullptr;
+        }
+
+        ///
+        /// Wait-free.
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Pointer to element mapped to key. nullptr if key is not
+        ///     valid
+        [[nodiscard]]
+        const T* find(const key_type key) const noexcept {
+            Slot* slot = checked_slot_at(key);
+            return slot ? slot->element() : nullptr;
+        }
+
+        //=================================================
+        // Element addition
+        //=================================================
+
+        /// Constructs an object from a set of parameters. May be called
+        /// concurrently with any other member function except the destructor.
+        ///
+        /// \tparam Args Argument types for constructor call
+        /// \param args  Constructor arguments for construction of new element
+        /// \return      Key mapped to newly constructed object
+        template<class... Args>
+        key_type emplace(Args&&...args) {
+            Shard& shard = local_shard();
+
+            size_type index = shard.pop(*this);
+            if (index == null_index) {
+                index = steal_free_slot();
+            }
+
+            if (index == null_index) {
+                index = new_slot();
+            }
+
+            Slot* slot = slot_at(index);
+            const size_type version = slot->version.load(std::memory_order_relaxed) + 1;
+
+            try {
+                std::allocator_traits<A>::construct(allocator, slot->element(), std::forward<Args>(args)...);
+            } catch (...) {
+                shard.push(*this, index);
+                throw;
+            }
+
+            slot->version.store(version, std::memory_order_release);
+            elem_count.fetch_add(1, std::memory_order_relaxed);
+
+            return key_type{index, version};
+        }
+
+        //=================================================
+        // Element removal
+        //=================================================
+
+        ///
+        /// If multiple threads attempt to erase the same element, exactly one
+        /// will succeed.
+        ///
+        /// \param key Key mapping to element to remove
+        /// \return True if an element was removed
+        bool erase(const key_type key) noexcept {
+            Slot* slot = checked_slot_at(key);
+            if (!slot) {
+                return false;
+            }
+
+            size_type expected = key.version;
+            if (!slot->version.compare_exchange_strong(expected, key.version + 1, std::memory_order_acq_rel)) {
+                return false;
+            }
+
+            std::allocator_traits<A>::destroy(allocator, slot->element());
+            elem_count.fetch_sub(1, std::memory_order_relaxed);
+
+            local_shard().push(*this, key.index);
+            return true;
+        }
+
+        //=================================================
+        // Size & capacity methods
+        //=================================================
+
+        ///
+        /// \return True if container has no elements. Approximate while
+        ///     other threads are modifying the container
+        ///
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        ///
+        /// \return Element count. Approximate while other threads are
+        ///     modifying the container
+        ///
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count.load(std::memory_order_relaxed);
+        }
+
+        ///
+        /// \return Number of slots that have been handed out so far
+        ///
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return std::min(slot_count.load(std::memory_order_relaxed), max_size());
+        }
+
+        ///
+        /// \return Maximum number of elements the container may hold
+        ///
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            return std::numeric_limits<size_type>::max() - base_chunk_size;
+        }
+
+        //=================================================
+        // Misc. methods
+        //=================================================
+
+        /// Wait-free.
+        ///
+        /// \param key Key to be checked
+        /// \return  Returns true if the key maps to a valid element
+        ///
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return checked_slot_at(key) != nullptr;
+        }
+
+        ///
+        /// \return Copy of internal allocator
+        ///
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        std::array<std::atomic<Slot*>, max_chunk_count> chunks{};
+
+        std::atomic<size_type> slot_count{0};
+
+        std::atomic<size_type> elem_count{0};
+
+        std::array<Shard, shard_count> shards{};
+
+        //=================================================
+        // Chunk helper methods
+        //=================================================
+
+        ///
+        /// \param x Non-zero value
+        /// \return Index of highest set bit in x
+        [[nodiscard]]
+        static size_type floor_log2(size_type x) noexcept {
+            size_type ret = 0;
+            for (size_type s = std::numeric_limits<size_type>::digits / 2; s != 0; s /= 2) {
+                if (x >> s) {
+                    x >>= s;
+                    ret += s;
+                }
+            }
+            return ret;
+        }
+
+        ///
+        /// \param k Chunk index
+        /// \return Number of slots in chunk k
+        [[nodiscard]]
+        static size_type chunk_size(const size_type k) noexcept {
+            return base_chunk_size << k;
+        }
+
+        ///
+        /// \param index Slot index. Must be less than max_size()
+        /// \return Index of chunk containing slot and offset into that chunk
+        [[nodiscard]]
+        static std::pair<size_type, size_type> locate(const size_type index) noexcept {
+            const size_type j = index + base_chunk_size;
+            const size_type k = floor_log2(j) - base_chunk_shift;
+            return {k, j - chunk_size(k)};
+        }
+
+        ///
+        /// \pre Slot at index must have been allocated
+        /// \param index Slot index
+        /// \return Pointer to slot
+        [[nodiscard]]
+        Slot* slot_at(const size_type index) const noexcept {
+            const auto [k, offset] = locate(index);
+            return chunks[k].load(std::memory_order_acquire) + offset;
+        }
+
+        ///
+        /// \param key Arbitrary key
+        /// \return Pointer to slot mapped to by key. nullptr if the key is not
+        ///     valid
+        [[nodiscard]]
+        Slot* checked_slot_at(const key_type key) const noexcept {
+            //Even versions never refer to elements
+            if (!(key.version & 1) || max_size() <= key.index) {
+                return nullptr;
+            }
+
+            const auto [k, offset] = locate(key.index);
+            Slot* chunk = chunks[k].load(std::memory_order_acquire);
+            if (!chunk) {
+                return nullptr;
+            }
+
+            Slot* slot = chunk + offset;
+            if (slot->version.load(std::memory_order_acquire) != key.version) {
+                return nullptr;
+            }
+
+            return slot;
+        }
+
+        ///
+        /// Hands out a slot which has never been used before, allocating a new
+        /// chunk if necessary. If several threads race to allocate the same
+        /// chunk, exactly one allocation is kept.
+        ///
+        /// \return Index of new slot
+        size_type new_slot() {
+            const size_type index = slot_count.fetch_add(1, std::memory_order_relaxed);
+            if (max_size() <= index) {
+                throw std::length_error("aul::Concurrent_slot_map grew beyond max size");
+            }
+
+            const auto [k, offset] = locate(index);
+            if (chunks[k].load(std::memory_order_acquire)) {
+                return index;
+            }
+
+            slot_allocator_type slot_allocator{allocator};
+            const size_type n = chunk_size(k);
+
+            slot_pointer p = slot_allocator_traits::allocate(slot_allocator, n);
+            Slot* chunk = aul::to_raw_pointer(p);
+            aul::default_construct(chunk, chunk + n, slot_allocator);
+
+            Slot* expected = nullptr;
+            if (!chunks[k].compare_exchange_strong(expected, chunk, std::memory_order_acq_rel)) {
+                aul::destroy(chunk, chunk + n, slot_allocator);
+                slot_allocator_traits::deallocate(slot_allocator, p, n);
+            }
+
+            return index;
+        }
+
+        //=================================================
+        // Free list helper methods
+        //=================================================
+
+        ///
+        /// \return Free list assigned to the calling thread
+        [[nodiscard]]
+        Shard& local_shard() noexcept {
+            thread_local const size_type shard_index =
+                std::hash<std::thread::id>{}(std::this_thread::get_id()) % shard_count;
+
+            return shards[shard_index];
+        }
+
+        ///
+        /// Attempts to take a free slot from another thread's free list
+        /// without blocking.
+        ///
+        /// \return Index of free slot. null_index if none could be taken
+        size_type steal_free_slot() noexcept {
+            for (Shard& shard : shards) {
+                const size_type index = shard.try_pop(*this);
+                if (index != null_index) {
+                    return index;
+                }
+            }
+
+            return null_index;
+        }
+
+    };
+
+    template<class T, class A>
+    class Concurrent_slot_map<T, A>::Slot {
+    public:
+
+        //=============================================
+        // Accessors
+        //=============================================
+
+        [[nodiscard]]
+        T* element() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        //=============================================
+        // Instance members
+        //=============================================
+
+        std::atomic<size_type> version{0};
+
+        size_type next_free = null_index;
+
+        alignas(T) unsigned char storage[sizeof(T)];
+
+    };
+
+    template<class T, class A>
+    class alignas(64) Concurrent_slot_map<T, A>::Shard {
+    public:
+
+        //=============================================
+        // Free list methods
+        //=============================================
+
+        ///
+        /// \param map Container owning the free list
+        /// \return Index of free slot. null_index if list was empty
+        size_type pop(Concurrent_slot_map& map) noexcept {
+            std::lock_guard<std::mutex> guard{lock};
+            return pop_unlocked(map);
+        }
+
+        ///
+        /// \param map Container owning the free list
+        /// \return Index of free slot. null_index if list was empty or was
+        ///     being used by another thread
+        size_type try_pop(Concurrent_slot_map& map) noexcept {
+            if (head.load(std::memory_order_relaxed) == null_index || !lock.try_lock()) {
+                return null_index;
+            }
+
+            std::lock_guard<std::mutex> guard{lock, std::adopt_lock};
+            return pop_unlocked(map);
+        }
+
+        ///
+        /// \param map Container owning the free list
+        /// \param index Index of slot to push onto free list
+        void push(Concurrent_slot_map& map, const size_type index) noexcept {
+            std::lock_guard<std::mutex> guard{lock};
+            map.slot_at(index)->next_free = head.load(std::memory_order_relaxed);
+            head.store(index, std::memory_order_relaxed);
+        }
+
+    private:
+
+        //=============================================
+        // Instance members
+        //=============================================
+
+        std::mutex lock;
+
+        ///
+        /// Only modified while lock is held. Atomic so that other threads may
+        /// cheaply check whether the list is empty before attempting to lock it
+        ///
+        std::atomic<size_type> head{null_index};
+
+        //=============================================
+        // Helper functions
+        //=============================================
+
+        size_type pop_unlocked(Concurrent_slot_map& map) noexcept {
+            const size_type index = head.load(std::memory_order_relaxed);
+            if (index != null_index) {
+                head.store(map.slot_at(index)->next_free, std::memory_order_relaxed);
+            }
+            return index;
+        }
+
+    };
+
+}
+
+#endif //AUL_CONCURRENT_SLOT_MAP_HPP
@@ -0,0 +1,484 @@
+#ifndef AUL_MPMC_CIRCULAR_ARRAY_HPP
+#define AUL_MPMC_CIRCULAR_ARRAY_HPP
+
+#include "Allocator_aware_base.hpp"
+
+#include "../memory/Allocation.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace aul {
+
+    ///
+    /// A fixed-capacity lock-free queue which any number of producer and
+    /// consumer threads may use concurrently.
+    ///
+    /// Follows Dmitry Vyukov's bounded MPMC queue design. Each slot of the
+    /// ring carries a sequence number which tells a producer whether the slot
+    /// is free for the current lap and tells a consumer whether it has been
+    /// filled. Threads claim positions by advancing a shared enqueue or
+    /// dequeue counter with a compare-and-swap, then touch only their own
+    /// slot, so producers and consumers only contend with their own kind.
+    ///
+    /// Capacity is rounded up to a power of two so that positions wrap with a
+    /// mask. At least two slots are always allocated, since with a single slot
+    /// the sequence number of a filled slot would equal the one marking it free
+    /// for the next lap.
+    ///
+    /// Since a claimed slot must always be published, T is required to be
+    /// nothrow move constructible and assignable. Elements that may throw
+    /// while being constructed are constructed before a slot is claimed.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class Mpmc_circular_array : public Allocator_aware_base<A> {
+        using base = Allocator_aware_base<A>;
+
+        static_assert(
+            std::is_nothrow_move_constructible<T>::value && std::is_nothrow_move_assignable<T>::value,
+            "aul::Mpmc_circular_array requires nothrow movable elements"
+        );
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+    private:
+
+        //=================================================
+        // Forward declarations
+        //=================================================
+
+        class Slot;
+
+        using slot_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Slot>;
+        using allocation_type = aul::Allocation<Slot, slot_allocator_type>;
+
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param n Minimum number of elements the queue must be able to hold.
+        ///     Rounded up to a power of two no less than 2
+        /// \param alloc Allocator to copy
+        explicit Mpmc_circular_array(const size_type n, const allocator_type& alloc = {}):
+            base(alloc) {
+
+            allocation = allocate(round_capacity(n));
+            mask = allocation.capacity - 1;
+        }
+
+        Mpmc_circular_array(const Mpmc_circular_array&) = delete;
+        Mpmc_circular_array(Mpmc_circular_array&&) = delete;
+
+        ///
+        /// Destroys all elements still in the queue. No thread may be
+        /// accessing the queue
+        ///
+        ~Mpmc_circular_array() {
+            const size_type d = dequeue_pos.load(std::memory_order_acquire);
+            const size_type e = enqueue_pos.load(std::memory_order_acquire);
+
+            auto allocator = get_allocator();
+            for (size_type pos = d; pos != e; ++pos) {
+                std::allocator_traits<A>::destroy(allocator, allocation.ptr[pos & mask].element());
+            }
+
+            deallocate(allocation);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Mpmc_circular_array& operator=(const Mpmc_circular_array&) = delete;
+        Mpmc_circular_array& operator=(Mpmc_circular_array&&) = delete;
+
+        //=================================================
+        // Producer methods
+        //=================================================
+
+        ///
+        /// Constructs a new element at the back of the queue if there is room
+        /// for it
+        ///
+        /// \tparam Args Argument types to element constructor
+        /// \param args Arguments to element constructor
+        /// \return True if the element was pushed. False if the queue was full
+        template<class...Args>
+        bool try_emplace(Args&&...args) {
+            if constexpr (std::is_nothrow_constructible<T, Args&&...>::value) {
+                size_type pos = 0;
+                if (!claim_push(pos)) {
+                    return false;
+                }
+
+                publish(pos, std::forward<Args>(args)...);
+                return true;
+            } else {
+                T temp(std::forward<Args>(args)...);
+                return try_emplace(std::move(temp));
+            }
+        }
+
+        ///
+        /// \param val Value to copy
+        /// \return True if the element was pushed. False if the queue was full
+        bool try_push(const T& val) {
+            return try_emplace(val);
+        }
+
+        ///
+        /// \param val Value to move
+        /// \return True if the element was pushed. False if the queue was full
+        bool try_push(T&& val) {
+            return try_emplace(std::move(val));
+        }
+
+        ///
+        /// Copies as many elements from the range beginning at first as there
+        /// are free slots, up to n, to the back of the queue. The slots are
+        /// claimed with a single compare-and-swap, so the elements are kept
+        /// together even with other producers active.
+        ///
+        /// If copying an element may throw, the elements are instead pushed
+        /// one at a time and may be interleaved with other producers'
+        /// elements. If copying throws, the elements pushed so far remain
+        /// pushed.
+        ///
+        /// \tparam It Input iterator type
+        /// \param first Iterator to beginning of range to copy
+        /// \param n Number of elements in range
+        /// \return Number of elements pushed
+        template<class It>
+        size_type push_bulk(It first, const size_type n) {
+            using source_reference = typename std::iterator_traits<It>::reference;
+
+            if constexpr (!std::is_nothrow_constructible<T, source_reference>::value) {
+                size_type count = 0;
+                for (; count < n; ++count, ++first) {
+                    if (!try_emplace(*first)) {
+                        break;
+                    }
+                }
+
+                return count;
+            } else {
+                size_type pos = enqueue_pos.load(std::memory_order_relaxed);
+
+                size_type count = 0;
+                for (;;) {
+                    count = 0;
+                    difference_type diff = 0;
+                    for (; count < n; ++count) {
+                        const size_type seq = allocation.ptr[(pos + count) & mask].sequence.load(std::memory_order_acquire);
+                        diff = static_cast<difference_type>(seq - (pos + count));
+                        if (diff != 0) {
+                            break;
+                        }
+                    }
+
+                    if (count != 0) {
+                        if (enqueue_pos.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) {
+                            break;
+                        }
+                    } else if (diff < 0 || n == 0) {
+                        return 0;
+                    } else {
+                        pos = enqueue_pos.load(std::memory_order_relaxed);
+                    }
+                }
+
+                //Slots are published individually so that consumers may begin
+                //popping before the whole batch has been constructed
+                for (size_type i = 0; i < count; ++i, ++first) {
+                    publish(pos + i, *first);
+                }
+
+                return count;
+            }
+        }
+
+        //=================================================
+        // Consumer methods
+        //=================================================
+
+        ///
+        /// Move assigns the front element to out and removes it from the
+        /// queue
+        ///
+        /// \param out Object to move front element to
+        /// \return True if an element was popped. False if the queue was empty
+        bool try_pop(T& out) noexcept {
+            size_type pos = dequeue_pos.load(std::memory_order_relaxed);
+
+            Slot* slot = nullptr;
+            for (;;) {
+                slot = allocation.ptr + (pos & mask);
+                const size_type seq = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<difference_type>(seq - (pos + 1));
+
+                if (diff == 0) {
+                    if (dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        break;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = dequeue_pos.load(std::memory_order_relaxed);
+                }
+            }
+
+            T* element = slot->element();
+            out = std::move(*element);
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::destroy(allocator, element);
+
+            //Free the slot for the producers of the next lap
+            slot->sequence.store(pos + mask + 1, std::memory_order_release);
+            return true;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// Only a snapshot if any thread is active
+        ///
+        /// \return Number of elements in the queue
+        [[nodiscard]]
+        size_type size() const noexcept {
+            const size_type d = dequeue_pos.load(std::memory_order_acquire);
+            const size_type e = enqueue_pos.load(std::memory_order_acquire);
+            return (e < d) ? 0 : std::min(e - d, capacity());
+        }
+
+        ///
+        /// Only a snapshot if any thread is active
+        ///
+        /// \return True if the queue holds no elements
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        ///
+        /// \return Number of elements the queue can hold. Always a power of
+        ///     two
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation.capacity;
+        }
+
+        ///
+        /// \return Copy of allocator used by container
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return base::get_allocator();
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        ///
+        /// Ring of slots. Never changes after construction
+        ///
+        allocation_type allocation{};
+
+        ///
+        /// capacity() - 1
+        ///
+        size_type mask{};
+
+        ///
+        /// Next position to be claimed by a producer
+        ///
+        alignas(64) std::atomic<size_type> enqueue_pos{0};
+
+        ///
+        /// Next position to be claimed by a consumer
+        ///
+        alignas(64) std::atomic<size_type> dequeue_pos{0};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// Claims the next position for a producer
+        ///
+        /// \param pos Set to claimed position
+        /// \return True if a position was claimed. False if the queue was full
+        bool claim_push(size_type& pos) noexcept {
+            pos = enqueue_pos.load(std::memory_order_relaxed);
+
+            for (;;) {
+                const size_type seq = allocation.ptr[pos & mask].sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<difference_type>(seq - pos);
+
+                if (diff == 0) {
+                    if (enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                        return true;
+                    }
+                } else if (diff < 0) {
+                    return false;
+                } else {
+                    pos = enqueue_pos.load(std::memory_order_relaxed);
+                }
+            }
+        }
+
+        ///
+        /// Constructs an element in the slot at a claimed position and makes
+        /// it visible to consumers
+        ///
+        /// \tparam Args Argument types to element constructor
+        /// \param pos Claimed position
+        /// \param args Arguments to element constructor. Construction must not
+        ///     throw
+        template<class...Args>
+        void publish(const size_type pos, Args&&...args) noexcept {
+            Slot& slot = allocation.ptr[pos & mask];
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::construct(allocator, slot.element_storage(), std::forward<Args>(args)...);
+
+            slot.sequence.store(pos + 1, std::memory_order_release);
+        }
+
+        ///
+        /// \param n Requested capacity
+        /// \return Smallest power of two not less than n or 2
+        [[nodiscard]]
+        size_type round_capacity(const size_type n) const {
+            const size_type max = std::min(
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()),
+                std::allocator_traits<slot_allocator_type>::max_size(slot_allocator_type{get_allocator()})
+            );
+
+            size_type ret = 2;
+            while (ret < n) {
+                if (max / 2 < ret) {
+                    throw std::length_error("aul::Mpmc_circular_array constructed with excessive capacity");
+                }
+                ret *= 2;
+            }
+
+            return ret;
+        }
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        ///
+        /// Slots are numbered so that the slot at each position is initially
+        /// free for the first lap
+        ///
+        /// \param n Number of slots to allocate
+        /// \return New allocation
+        [[nodiscard]]
+        allocation_type allocate(const size_type n) {
+            slot_allocator_type allocator{get_allocator()};
+
+            allocation_type ret{};
+            ret.ptr = std::allocator_traits<slot_allocator_type>::allocate(allocator, n);
+            ret.capacity = n;
+
+            for (size_type i = 0; i < n; ++i) {
+                ::new (static_cast<void*>(std::addressof(ret.ptr[i]))) Slot{i};
+            }
+
+            return ret;
+        }
+
+        void deallocate(allocation_type& alloc) noexcept {
+            if (alloc.ptr) {
+                for (size_type i = 0; i < alloc.capacity; ++i) {
+                    alloc.ptr[i].~Slot();
+                }
+
+                slot_allocator_type allocator{get_allocator()};
+                std::allocator_traits<slot_allocator_type>::deallocate(allocator, alloc.ptr, alloc.capacity);
+            }
+
+            alloc = {};
+        }
+
+    };
+
+    ///
+    /// A position in the ring along with storage for one element
+    ///
+    template<class T, class A>
+    class Mpmc_circular_array<T, A>::Slot {
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        explicit Slot(const size_type seq) noexcept:
+            sequence(seq) {}
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Pointer to uninitialized storage for element
+        T* element_storage() noexcept {
+            return reinterpret_cast<T*>(storage);
+        }
+
+        ///
+        /// Only valid while the slot holds an element
+        ///
+        /// \return Pointer to element
+        T* element() noexcept {
+            return std::launder(reinterpret_cast<T*>(storage));
+        }
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        ///
+        /// Equal to the position a producer may claim this slot at when it's
+        /// free, or to one past the position it was claimed at when filled
+        ///
+        std::atomic<size_type> sequence;
+
+        alignas(T) unsigned char storage[sizeof(T)];
+
+    };
+
+}
+
+#endif //AUL_MPMC_CIRCULAR_ARRAY_HPP
@@ -0,0 +1,305 @@
+#ifndef AUL_SLIDING_WINDOW_HPP
+#define AUL_SLIDING_WINDOW_HPP
+
+#include "Circular_array.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace aul {
+
+    ///
+    /// Maintains the combination of the most recent n values under an
+    /// associative binary operation, such as a sum, minimum, or maximum.
+    /// Pushing a value onto a full window evicts the oldest value.
+    ///
+    /// The values are held in a single aul::Circular_array which is used as
+    /// a two-stack queue. Each value is stored alongside a partial
+    /// aggregate:
+    /// - For the oldest values, up to a boundary, the combination of that
+    ///   value and every value after it up to the boundary
+    /// - For the values after the boundary, the combination of every value
+    ///   from the boundary up to and including that value
+    ///
+    /// The aggregate of the whole window is therefore at most one
+    /// application of the operation. When popping exhausts the values before
+    /// the boundary, the partial aggregates of the remaining values are
+    /// recomputed and the boundary moves to the end. Each value takes part in
+    /// at most one such recomputation, so push, pop, and aggregate are all
+    /// amortized O(1).
+    ///
+    /// The operation is always applied with the older operand on the left,
+    /// so it need not be commutative.
+    ///
+    /// \tparam T Value type
+    /// \tparam Op Associative binary operation type
+    /// \tparam A Allocator type
+    template<class T, class Op = std::plus<>, class A = std::allocator<T>>
+    class Sliding_window {
+
+        struct Entry {
+            T value;
+            T aggregate;
+        };
+
+        using entry_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<Entry>;
+
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using operation_type = Op;
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param n Number of values in a full window. Must be nonzero
+        /// \param op Operation used to combine values
+        /// \param alloc Allocator to copy
+        explicit Sliding_window(const size_type n, Op op = {}, const allocator_type& alloc = {}):
+            entries(entry_allocator_type{alloc}),
+            op(std::move(op)),
+            window_size(n) {
+
+            if (n == 0) {
+                throw std::length_error("aul::Sliding_window must have nonzero size");
+            }
+
+            entries.reserve(n);
+        }
+
+        //=================================================
+        // Element addition/removal
+        //=================================================
+
+        ///
+        /// Adds a value to the window, evicting the oldest value if the
+        /// window is full
+        ///
+        /// \param val Value to add
+        void push(const T& val) {
+            if (entries.size() == window_size) {
+                pop();
+            }
+
+            push_within_capacity(val);
+        }
+
+        ///
+        /// Adds a block of values to the window, in order, evicting as many of
+        /// the oldest values as necessary. Values in the block which would
+        /// themselves be evicted before the end of the block are skipped.
+        ///
+        /// \tparam It Forward iterator type
+        /// \param from Iterator to beginning of block
+        /// \param to Iterator to end of block
+        template<class It>
+        void push(It from, const It to) {
+            const size_type n = static_cast<size_type>(std::distance(from, to));
+
+            if (window_size <= n) {
+                std::advance(from, n - window_size);
+                clear();
+            } else if (window_size - entries.size() < n) {
+                pop_n(n - (window_size - entries.size()));
+            }
+
+            for (; from != to; ++from) {
+                push_within_capacity(*from);
+            }
+        }
+
+        ///
+        /// Removes the oldest value in the window. Undefined behavior if the
+        /// window is empty.
+        ///
+        void pop() {
+            if (boundary == 0) {
+                flip();
+            }
+
+            entries.pop_front();
+            --boundary;
+        }
+
+        ///
+        /// Removes the n oldest values in the window. Undefined behavior if
+        /// the window holds fewer than n values.
+        ///
+        /// \param n Number of values to remove
+        void pop_n(size_type n) {
+            if (boundary < n) {
+                n -= boundary;
+                for (; boundary != 0; --boundary) {
+                    entries.pop_front();
+                }
+
+                flip();
+            }
+
+            boundary -= n;
+            for (; n != 0; --n) {
+                entries.pop_front();
+            }
+        }
+
+        ///
+        /// Removes all values from the window
+        ///
+        void clear() {
+            entries.clear();
+            boundary = 0;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// Undefined behavior if the window is empty.
+        ///
+        /// \return Combination of all values in the window, from oldest to
+        ///     newest
+        [[nodiscard]]
+        T aggregate() const {
+            if (boundary == 0) {
+                return entries.back().aggregate;
+            }
+
+            if (boundary == entries.size()) {
+                return entries.front().aggregate;
+            }
+
+            return op(entries.front().aggregate, entries.back().aggregate);
+        }
+
+        ///
+        /// \param i Index of value, where zero is the oldest value
+        /// \return Reference to value
+        [[nodiscard]]
+        const T& operator[](const size_type i) const {
+            return entries[i].value;
+        }
+
+        ///
+        /// \return Oldest value in the window
+        [[nodiscard]]
+        const T& front() const {
+            return entries.front().value;
+        }
+
+        ///
+        /// \return Newest value in the window
+        [[nodiscard]]
+        const T& back() const {
+            return entries.back().value;
+        }
+
+        [[nodiscard]]
+        const Op& operation() const noexcept {
+            return op;
+        }
+
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator_type{entries.get_allocator()};
+        }
+
+        //=================================================
+        // Size methods
+        //=================================================
+
+        ///
+        /// \return Number of values currently in the window
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return entries.size();
+        }
+
+        ///
+        /// \return Number of values in a full window
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return window_size;
+        }
+
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return entries.empty();
+        }
+
+        [[nodiscard]]
+        bool full() const noexcept {
+            return entries.size() == window_size;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        aul::Circular_array<Entry, entry_allocator_type> entries;
+
+        Op op;
+
+        size_type window_size = 0;
+
+        ///
+        /// Number of values, starting from the oldest, whose aggregates extend
+        /// towards the newest value
+        ///
+        size_type boundary = 0;
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// Adds a value under the assumption that the window is not full
+        ///
+        /// \param val Value to add
+        void push_within_capacity(const T& val) {
+            if (boundary == entries.size()) {
+                entries.push_back(Entry{val, val});
+            } else {
+                entries.push_back(Entry{val, op(entries.back().aggregate, val)});
+            }
+        }
+
+        ///
+        /// Recomputes the aggregates of all values so that they extend towards
+        /// the newest value, and moves the boundary to the end
+        ///
+        void flip() {
+            boundary = entries.size();
+            if (boundary == 0) {
+                return;
+            }
+
+            auto it = entries.end() - 1;
+            it->aggregate = it->value;
+            while (it != entries.begin()) {
+                const auto next = it;
+                --it;
+                it->aggregate = op(it->value, next->aggregate);
+            }
+        }
+
+    };
+
+}
+
+#endif //AUL_SLIDING_WINDOW_HPP
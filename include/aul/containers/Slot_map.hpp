@@ -8,20 +8,40 @@
 #include "../Versioned_type.hpp"
 #include "../memory/Memory.hpp"
 #include "../Algorithms.hpp"
+#include "../Span.hpp"
 #include "Random_access_iterator.hpp"
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
+#include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 #include <stdexcept>
 
+#if defined(__AVX2__) || defined(__AVX512F__)
+#include <immintrin.h>
+#endif
+
+#if defined(__linux__)
+#include <cerrno>
+#include <system_error>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace aul {
 
-    template<class T, class A>
+    template<class T, class A, class K>
     class Slot_map;
 
 
@@ -34,9 +54,24 @@ namespace aul {
         static_assert(std::numeric_limits<T>::is_integer);
         static_assert(!std::numeric_limits<T>::is_signed);
 
-        template<class U, class A>
+        template<class U, class A, class K>
         friend class Slot_map;
 
+        //=================================================
+        // Static constants
+        //=================================================
+
+        ///
+        /// Largest value the index may hold. Reserved for null keys
+        ///
+        static constexpr T max_index = std::numeric_limits<T>::max();
+
+        ///
+        /// Largest value the version may hold. Reserved for null keys and
+        /// retired anchors
+        ///
+        static constexpr T max_version = std::numeric_limits<T>::max();
+
         //=================================================
         // -ctors
         //=================================================
@@ -94,6 +129,103 @@ namespace aul {
 
     };
 
+    ///
+    /// A key type for aul::Slot_map which packs the index and version into
+    /// a single unsigned integer, e.g. a 20-bit index and a 12-bit version
+    /// inside of a std::uint32_t.
+    ///
+    /// A Slot_map using this key type can hold at most max_index elements.
+    /// Once an anchor's version reaches max_version - 1, erasing the element
+    /// it refers to retires the anchor instead of recycling it, so a stale
+    /// key can never match a newer element due to the version wrapping
+    /// around.
+    ///
+    /// \tparam U Unsigned integral type to pack index and version into
+    /// \tparam Index_bits Number of bits used for index
+    /// \tparam Version_bits Number of bits used for version
+    template<class U, unsigned Index_bits, unsigned Version_bits = std::numeric_limits<U>::digits - Index_bits>
+    struct Packed_slot_map_key {
+        static_assert(std::numeric_limits<U>::is_integer);
+        static_assert(!std::numeric_limits<U>::is_signed);
+        static_assert(0 < Index_bits && 1 < Version_bits);
+        static_assert(Index_bits + Version_bits <= std::numeric_limits<U>::digits);
+
+        //=================================================
+        // Static constants
+        //=================================================
+
+        ///
+        /// Largest value the index may hold. Reserved for null keys
+        ///
+        static constexpr U max_index = U(~U{0}) >> (std::numeric_limits<U>::digits - Index_bits);
+
+        ///
+        /// Largest value the version may hold. Reserved for null keys and
+        /// retired anchors
+        ///
+        static constexpr U max_version = U(~U{0}) >> (std::numeric_limits<U>::digits - Version_bits);
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Packed_slot_map_key(const std::uintmax_t index, const std::uintmax_t version):
+            index(static_cast<U>(index)),
+            version(static_cast<U>(version)) {}
+
+        Packed_slot_map_key():
+            index(max_index),
+            version(max_version) {}
+
+        Packed_slot_map_key(const Packed_slot_map_key&) = default;
+        Packed_slot_map_key(Packed_slot_map_key&&) noexcept = default;
+        ~Packed_slot_map_key() = default;
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Packed_slot_map_key& operator=(const Packed_slot_map_key&) = default;
+        Packed_slot_map_key& operator=(Packed_slot_map_key&&) noexcept = default;
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        bool operator==(const Packed_slot_map_key& key) const {
+            return (index == key.index) && (version == key.version);
+        }
+
+        bool operator!=(const Packed_slot_map_key& key) const {
+            return (index != key.index) || (version != key.version);
+        }
+
+        bool operator<(const Packed_slot_map_key& key) const {
+            return (index < key.index) || ((index == key.index) && (version < key.version));
+        }
+
+        bool operator>(const Packed_slot_map_key& key) const {
+            return key < *this;
+        }
+
+        bool operator<=(const Packed_slot_map_key& key) const {
+            return !(key < *this);
+        }
+
+        bool operator>=(const Packed_slot_map_key& key) const {
+            return !(*this < key);
+        }
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        U index : Index_bits;
+        U version : Version_bits;
+
+    };
+
+
 
 
 
@@ -121,9 +253,15 @@ namespace aul {
     /// A default-constructed value of key_type is very unlikely to map to
     /// any object at any time and thus can effectively be used as a null key.
     ///
+    /// The key type may be replaced with a more compact one such as
+    /// aul::Packed_slot_map_key. The container's size is then limited by the
+    /// key's max_index, and anchors whose version can no longer be
+    /// represented by the key are retired rather than reused.
+    ///
     /// \tparam T Element type
     /// \tparam A Allocator type
-    template<class T, class A = std::allocator<T>>
+    /// \tparam K Key type
+    template<class T, class A = std::allocator<T>, class K = Slot_map_key<typename std::allocator_traits<A>::size_type>>
     class Slot_map {
 
         //=================================================
@@ -134,6 +272,8 @@ namespace aul {
 
         class Metadata;
 
+        class Image_header;
+
         //=================================================
         // Type aliases
         //=================================================
@@ -149,7 +289,7 @@ namespace aul {
         using const_pointer = typename std::allocator_traits<allocator_type>::const_pointer;
 
         using value_type = T;
-        using key_type = Slot_map_key<size_type>;
+        using key_type = K;
 
         using reference = T&;
         using const_reference = const T&;
@@ -189,10 +329,12 @@ namespace aul {
             allocator(std::move(right.allocator)),
             allocation(std::move(right.allocation)),
             elem_count(std::move(right.elem_count)),
-            free_anchor(std::move(right.free_anchor)) {
+            free_anchor(std::move(right.free_anchor)),
+            retired_anchor_count(std::move(right.retired_anchor_count)) {
 
             right.elem_count = 0;
             right.free_anchor = nullptr;
+            right.retired_anchor_count = 0;
         }
 
         ///
@@ -203,7 +345,8 @@ namespace aul {
             allocator(alloc),
             allocation((alloc == right.get_allocator()) ? std::move(right.allocation) : allocate(right.capacity())),
             elem_count(right.elem_count),
-            free_anchor(allocation.metadata + (right.free_anchor - right.allocation.metadata)) {
+            free_anchor(allocation.metadata + (right.free_anchor - right.allocation.metadata)),
+            retired_anchor_count(right.retired_anchor_count) {
 
             static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
 
@@ -213,6 +356,7 @@ namespace aul {
 
             right.elem_count = 0;
             right.free_anchor = nullptr;
+            right.retired_anchor_count = 0;
         }
 
         ///
@@ -222,7 +366,8 @@ namespace aul {
             allocator(allocator_traits::select_on_container_copy_construction(src.allocator)),
             allocation(allocate(src.allocation.capacity)),
             elem_count(src.elem_count),
-            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)) {
+            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)),
+            retired_anchor_count(src.retired_anchor_count) {
 
             static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
             //TODO: Provide strong-exception guarantee
@@ -240,7 +385,8 @@ namespace aul {
             allocator(alloc),
             allocation(allocate(src.allocation.capacity)),
             elem_count(src.elem_count),
-            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)) {
+            free_anchor(allocation.metadata + (src.free_anchor - src.allocation.metadata)),
+            retired_anchor_count(src.retired_anchor_count) {
 
             static_assert(std::is_copy_constructible<T>::value, "Type T is not copy constructable.");
             //TODO: Provide strong exception guarantee
@@ -282,6 +428,7 @@ namespace aul {
 
             elem_count = 0;
             free_anchor = nullptr;
+            retired_anchor_count = 0;
         }
 
         /// Replaces the contents of the current object those of src. Also swaps
@@ -297,6 +444,7 @@ namespace aul {
             std::swap(allocation, src.allocation);
             std::swap(elem_count, src.elem_count);
             std::swap(free_anchor, src.free_anchor);
+            std::swap(retired_anchor_count, src.retired_anchor_count);
         }
 
         ///
@@ -330,6 +478,7 @@ namespace aul {
             allocation = allocate(src.allocation.capacity);
             elem_count = src.elem_count;
             free_anchor = allocation.metadata + (src.free_anchor - src.allocation.metadata);
+            retired_anchor_count = src.retired_anchor_count;
 
             auto md_allocator = md_allocator_type{allocator};
 
@@ -354,12 +503,14 @@ namespace aul {
                 allocator = std::move(src.allocator);
             }
 
-            allocation = std::move(allocation);
-            elem_count = std::move(elem_count);
-            free_anchor = std::move(free_anchor);
+            allocation = std::move(src.allocation);
+            elem_count = std::move(src.elem_count);
+            free_anchor = std::move(src.free_anchor);
+            retired_anchor_count = std::move(src.retired_anchor_count);
 
             src.elem_count = 0;
             src.free_anchor = nullptr;
+            src.retired_anchor_count = 0;
 
             return *this;
         }
@@ -431,7 +582,12 @@ namespace aul {
                 throw std::length_error("aul::Slot_map grew beyond max size");
             }
 
-            if (size() + 1 <= capacity()) {
+            //All unused anchors have been retired
+            if (!free_anchor && size() != capacity()) {
+                reserve(grow_size(capacity() + 1));
+            }
+
+            if (free_anchor) {
                 construct_element(allocation.elements + size(), std::forward<Args>(args)...);
             } else {
                 //Make new allocation
@@ -473,6 +629,67 @@ namespace aul {
             return iterator{ allocation.elements + size() - 1 };
         }
 
+        /// Constructs n elements from the same set of parameters. Capacity is
+        /// checked once and all n anchors are taken off the free list in a
+        /// single pass.
+        ///
+        /// Provides the strong exception guarantee with respect to element
+        /// construction.
+        ///
+        /// \tparam Out_iter Output iterator type accepting key_type
+        /// \tparam Args Argument types for constructor call
+        /// \param n Number of elements to construct
+        /// \param keys Iterator to beginning of range to write new keys to
+        /// \param args Constructor arguments for each new element
+        /// \return Iterator to end of range of written keys
+        template<class Out_iter, class...Args>
+        Out_iter emplace_n(const size_type n, Out_iter keys, const Args&...args) {
+            reserve_additional(n);
+
+            pointer first = allocation.elements + size();
+            pointer p = first;
+            try {
+                for (; p != first + n; ++p) {
+                    allocator_traits::construct(allocator, p, args...);
+                }
+            } catch (...) {
+                aul::destroy(first, p, allocator);
+                throw;
+            }
+
+            keys = consume_anchors(size(), n, keys);
+            elem_count += n;
+
+            return keys;
+        }
+
+        /// Copy-inserts the elements in the range [from, to). Capacity is
+        /// checked once and all anchors are taken off the free list in a
+        /// single pass.
+        ///
+        /// Provides the strong exception guarantee with respect to element
+        /// construction.
+        ///
+        /// \tparam F_iter Forward iterator type
+        /// \tparam Out_iter Output iterator type accepting key_type
+        /// \param from Iterator to beginning of range of elements to insert
+        /// \param to Iterator to end of range of elements to insert
+        /// \param keys Iterator to beginning of range to write new keys to
+        /// \return Iterator to end of range of written keys
+        template<class F_iter, class Out_iter>
+        Out_iter insert(F_iter from, F_iter to, Out_iter keys) {
+            const auto n = static_cast<size_type>(std::distance(from, to));
+            reserve_additional(n);
+
+            pointer first = allocation.elements + size();
+            aul::uninitialized_copy(from, to, first, allocator);
+
+            keys = consume_anchors(size(), n, keys);
+            elem_count += n;
+
+            return keys;
+        }
+
         //=================================================
         // Element removal
         //=================================================
@@ -481,12 +698,12 @@ namespace aul {
         /// \param key Key mapping to element if
         /// \ret True if an element was removed
         bool erase(const key_type key) noexcept {
-            md_pointer md = allocation.metadata + key.index;
-            if (md->anchor.version() != key.version) {
+            if (!contains(key)) {
                 return false;
             }
 
-            auto ptr = allocation.elements + key.index;
+            md_pointer md = allocation.metadata + key.index;
+            auto ptr = allocation.elements + md->anchor.data();
 
             pointer last_ptr = allocation.elements + size() - 1;
             md_pointer last_md = metadata_of(last_ptr);
@@ -497,13 +714,7 @@ namespace aul {
 
             allocator_traits::destroy(allocator, last_ptr);
 
-            if (free_anchor) {
-                md->anchor = free_anchor - allocation.metadata;
-            }
-            else {
-                md->anchor = (md - allocation.metadata);
-            }
-            free_anchor = md;
+            release_anchor(md);
             --elem_count;
             return true;
         }
@@ -524,14 +735,149 @@ namespace aul {
 
             allocator_traits::destroy(allocator, last_ptr);
 
-            if (free_anchor) {
-                md->anchor = free_anchor - allocation.metadata;
+            release_anchor(md);
+            --elem_count;
+        }
+
+        /// Erases all elements mapped to by the keys in the specified range.
+        /// Invalid and repeated keys are ignored.
+        ///
+        /// Rather than moving the last element into each vacated slot in
+        /// turn, only the surviving elements past the new end of the element
+        /// array are moved, each exactly once, and the tail is then destroyed
+        /// in one pass.
+        ///
+        /// \param keys Keys mapping to elements to erase
+        /// \return Number of elements that were removed
+        size_type erase(aul::Span<const key_type> keys) noexcept {
+            constexpr size_type erased_mark = std::numeric_limits<size_type>::max();
+
+            // Mark positions of elements to be removed
+            size_type erase_count = 0;
+            for (const key_type key : keys) {
+                if (!contains(key)) {
+                    continue;
+                }
+
+                size_type pos = allocation.metadata[key.index].anchor.data();
+                if (allocation.metadata[pos].anchor_index == erased_mark) {
+                    continue;
+                }
+
+                allocation.metadata[pos].anchor_index = erased_mark;
+                ++erase_count;
             }
-            else {
-                md->anchor = (md - allocation.metadata);
+
+            if (erase_count == 0) {
+                return 0;
             }
-            free_anchor = md;
-            --elem_count;
+
+            // Fill vacated slots below the new size with survivors from the
+            // tail and release anchors
+            const size_type new_size = elem_count - erase_count;
+            size_type tail = elem_count;
+            for (const key_type key : keys) {
+                if (!contains(key)) {
+                    continue;
+                }
+
+                md_pointer md = allocation.metadata + key.index;
+                const size_type pos = md->anchor.data();
+
+                if (pos < new_size) {
+                    do {
+                        --tail;
+                    } while (allocation.metadata[tail].anchor_index == erased_mark);
+
+                    allocation.elements[pos] = std::move(allocation.elements[tail]);
+
+                    const size_type moved_anchor = allocation.metadata[tail].anchor_index;
+                    allocation.metadata[pos].anchor_index = moved_anchor;
+                    allocation.metadata[moved_anchor].anchor.data() = pos;
+                }
+
+                release_anchor(md);
+            }
+
+            aul::destroy(allocation.elements + new_size, allocation.elements + elem_count, allocator);
+            elem_count = new_size;
+
+            return erase_count;
+        }
+
+        //=================================================
+        // Reordering methods
+        //=================================================
+
+        /// Permutes the elements in place such that the element at position
+        /// i afterwards is the element that was previously at position
+        /// permutation[i]. All keys remain mapped to the same elements.
+        ///
+        /// Each element is moved exactly once by following the cycles of the
+        /// permutation, and the anchor of each element is patched as it is
+        /// placed.
+        ///
+        /// If moving an element throws, every key remains valid and the
+        /// container remains consistent, but which element each key maps to
+        /// is unspecified for elements which had not yet been placed.
+        ///
+        /// \pre permutation.size() == size() and permutation contains each
+        /// value in [0, size()) exactly once. This is not checked.
+        ///
+        /// \param permutation Permutation of [0, size())
+        void reorder(aul::Span<const size_type> permutation) noexcept(
+            std::is_nothrow_move_constructible_v<T> &&
+            std::is_nothrow_move_assignable_v<T>
+        ) {
+            constexpr size_type unplaced = std::numeric_limits<size_type>::max();
+
+            //Anchors of elements which have not yet reached their final
+            //position are marked as unplaced
+            for (size_type i = 0; i != elem_count; ++i) {
+                allocation.metadata[allocation.metadata[i].anchor_index].anchor.data() = unplaced;
+            }
+
+            size_type dest = 0;
+            size_type temp_anchor = 0;
+            if constexpr (std::is_nothrow_move_constructible_v<T> && std::is_nothrow_move_assignable_v<T>) {
+                place_cycles(permutation, dest, temp_anchor);
+            } else {
+                try {
+                    place_cycles(permutation, dest, temp_anchor);
+                } catch (...) {
+                    //The anchor of the element held in temp is the only one
+                    //which is not attached to some position. Hand it the
+                    //vacant position and point every anchor back at the
+                    //position that holds it
+                    allocation.metadata[dest].anchor_index = temp_anchor;
+                    for (size_type i = 0; i != elem_count; ++i) {
+                        place_anchor(i, allocation.metadata[i].anchor_index);
+                    }
+                    throw;
+                }
+            }
+        }
+
+        /// Sorts the elements in place. All keys remain mapped to the same
+        /// elements. Not stable.
+        ///
+        /// Useful for bringing the element array into an order which matches
+        /// that of other containers so that they may be traversed jointly.
+        ///
+        /// \tparam C Comparator type
+        /// \param comp Comparator object
+        template<class C = std::less<>>
+        void sort(C comp = {}) {
+            using index_allocator_type = typename allocator_traits::template rebind_alloc<size_type>;
+
+            std::vector<size_type, index_allocator_type> permutation(elem_count, index_allocator_type{allocator});
+            std::iota(permutation.begin(), permutation.end(), size_type{0});
+
+            std::sort(permutation.begin(), permutation.end(), [&] (const size_type a, const size_type b) {
+                return comp(allocation.elements[a], allocation.elements[b]);
+            });
+
+            reorder(aul::Span<const size_type>{permutation.size(), permutation.data()});
         }
 
         //=================================================
@@ -602,7 +948,7 @@ namespace aul {
 
             const size_type memory_max = element_max / (sizeof(value_type) + sizeof(Metadata));
 
-            return std::min(size_type_max, memory_max);
+            return std::min({size_type_max, memory_max, size_type(key_type::max_index)});
         }
 
         ///
@@ -694,6 +1040,44 @@ namespace aul {
             return (key.index < allocation.capacity) && (key.version == allocation.metadata[key.index].anchor.version());
         }
 
+        /// Checks which of the specified keys map to valid elements. Bit
+        /// i % 64 of bitmask[i / 64] is set if keys[i] maps to a valid
+        /// element and cleared otherwise.
+        ///
+        /// When compiled with AVX2 or AVX-512 support and using the default
+        /// key type, anchor versions are fetched with vector gathers and
+        /// compared several keys at a time.
+        ///
+        /// \param keys Keys to be checked
+        /// \param bitmask Output words. Must hold at least
+        ///     (keys.size() + 63) / 64 elements
+        void contains_many(aul::Span<const key_type> keys, aul::Span<std::uint64_t> bitmask) const noexcept {
+            for (std::size_t i = 0; i < keys.size(); i += 64) {
+                const std::size_t n = std::min<std::size_t>(64, keys.size() - i);
+                bitmask[i / 64] = validate_keys(keys.data() + i, n);
+            }
+        }
+
+        /// Resolves each of the specified keys to a pointer to the element it
+        /// maps to, or nullptr if the key is invalid.
+        ///
+        /// \param keys Keys to be resolved
+        /// \param pointers Output pointers. Must hold at least keys.size()
+        ///     elements
+        void resolve_many(aul::Span<const key_type> keys, aul::Span<pointer> pointers) noexcept {
+            resolve_keys(keys, pointers.data());
+        }
+
+        /// Resolves each of the specified keys to a pointer to the element it
+        /// maps to, or nullptr if the key is invalid.
+        ///
+        /// \param keys Keys to be resolved
+        /// \param pointers Output pointers. Must hold at least keys.size()
+        ///     elements
+        void resolve_many(aul::Span<const key_type> keys, aul::Span<const_pointer> pointers) const noexcept {
+            resolve_keys(keys, pointers.data());
+        }
+
         ///
         /// \return Copy of internal allocator
         ///
@@ -718,6 +1102,138 @@ namespace aul {
             return allocation.elements;
         }
 
+        //=================================================
+        // Image methods
+        //=================================================
+
+        #if defined(__linux__)
+
+        /// Writes the container's contents to fd as a flat binary image
+        /// which can later be loaded via map_image(). Keys issued by this
+        /// container remain valid for the loaded container.
+        ///
+        /// The image consists of a header followed by the element array and
+        /// the metadata array, each padded to its alignment, so that both
+        /// arrays can be used in place once the file is memory-mapped. Images
+        /// are only portable between builds with the same T, size_type, and
+        /// byte order.
+        ///
+        /// \param fd File descriptor open for writing
+        void write_image(const int fd) const {
+            static_assert(std::is_trivially_copyable<T>::value, "Images require a trivially copyable T");
+
+            const Image_header header = make_image_header();
+
+            std::size_t written = 0;
+            write_image_bytes(fd, &header, sizeof(Image_header), written);
+
+            write_image_bytes(fd, nullptr, header.elements_offset - written, written);
+            write_image_bytes(fd, aul::to_raw_pointer(allocation.elements), elem_count * sizeof(T), written);
+
+            //Unused element storage is written as zeros
+            write_image_bytes(fd, nullptr, header.metadata_offset - written, written);
+            write_image_bytes(fd, aul::to_raw_pointer(allocation.metadata), allocation.capacity * sizeof(Metadata), written);
+        }
+
+        /// Loads an image previously written by write_image() by mapping the
+        /// file into memory. The element and metadata arrays are used in
+        /// place rather than copied. The mapping is private, so modifying the
+        /// container does not modify the file.
+        ///
+        /// Growing the container moves its contents into memory obtained
+        /// from the allocator and unmaps the file.
+        ///
+        /// The header and the metadata array are validated before use, and
+        /// std::runtime_error is thrown if they don't describe a consistent
+        /// container.
+        ///
+        /// \param path Path to image file
+        /// \param alloc Allocator to use for any subsequent growth
+        /// \return Slot_map holding the image's contents
+        [[nodiscard]]
+        static Slot_map map_image(const char* path, const allocator_type& alloc = allocator_type{}) {
+            static_assert(std::is_trivially_copyable<T>::value, "Images require a trivially copyable T");
+            static_assert(std::is_same<pointer, T*>::value, "Images require an allocator with raw pointers");
+
+            const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+            if (fd == -1) {
+                throw std::system_error(errno, std::generic_category(), "aul::Slot_map::map_image() could not open file");
+            }
+
+            struct stat file_stats{};
+            if (::fstat(fd, &file_stats) == -1) {
+                const int error = errno;
+                ::close(fd);
+                throw std::system_error(error, std::generic_category(), "aul::Slot_map::map_image() could not stat file");
+            }
+
+            const auto file_size = static_cast<std::size_t>(file_stats.st_size);
+            if (file_size < sizeof(Image_header)) {
+                ::close(fd);
+                throw std::runtime_error("aul::Slot_map::map_image() called on file which is not an image");
+            }
+
+            void* image = ::mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+            const int error = errno;
+            ::close(fd);
+
+            if (image == MAP_FAILED) {
+                throw std::system_error(error, std::generic_category(), "aul::Slot_map::map_image() could not map file");
+            }
+
+            Image_header header{};
+            std::memcpy(&header, image, sizeof(Image_header));
+
+            //Bounding the capacity by the file size first ensures that
+            //computing the expected offsets from it cannot overflow
+            const bool is_capacity_plausible =
+                (header.capacity <= file_size / sizeof(T)) &&
+                (header.capacity <= file_size / sizeof(Metadata));
+
+            bool is_valid = is_capacity_plausible;
+            if (is_valid) {
+                const Image_header expected = make_image_header(header.capacity, header.size);
+                is_valid =
+                    (std::memcmp(header.magic, expected.magic, sizeof(header.magic)) == 0) &&
+                    (header.element_size == expected.element_size) &&
+                    (header.metadata_size == expected.metadata_size) &&
+                    (header.elements_offset == expected.elements_offset) &&
+                    (header.metadata_offset == expected.metadata_offset) &&
+                    (header.metadata_offset <= file_size) &&
+                    (header.capacity <= (file_size - header.metadata_offset) / sizeof(Metadata)) &&
+                    (header.size <= header.capacity) &&
+                    (header.free_anchor < header.capacity || header.free_anchor == Image_header::null_index);
+            }
+
+            if (is_valid) {
+                const auto* bytes = static_cast<const unsigned char*>(image);
+                const auto* metadata = reinterpret_cast<const Metadata*>(bytes + header.metadata_offset);
+                is_valid = is_image_metadata_consistent(metadata, header);
+            }
+
+            if (!is_valid) {
+                ::munmap(image, file_size);
+                throw std::runtime_error("aul::Slot_map::map_image() called on invalid or incompatible image");
+            }
+
+            auto* bytes = static_cast<unsigned char*>(image);
+
+            Slot_map ret{alloc};
+            ret.allocation.elements = reinterpret_cast<pointer>(bytes + header.elements_offset);
+            ret.allocation.metadata = reinterpret_cast<md_pointer>(bytes + header.metadata_offset);
+            ret.allocation.capacity = header.capacity;
+            ret.allocation.image = image;
+            ret.allocation.image_size = file_size;
+
+            ret.elem_count = header.size;
+            ret.free_anchor = (header.free_anchor == Image_header::null_index) ? nullptr : ret.allocation.metadata + header.free_anchor;
+            ret.retired_anchor_count = header.retired_anchor_count;
+
+            return ret;
+        }
+
+        #endif
+
     private:
 
         //=================================================
@@ -732,6 +1248,12 @@ namespace aul {
 
         md_pointer free_anchor = nullptr;
 
+        ///
+        /// Number of anchors whose versions were exhausted and which will
+        /// therefore never be reused
+        ///
+        size_type retired_anchor_count = 0;
+
         //=================================================
         // Misc. helper methods
         //=================================================
@@ -741,12 +1263,25 @@ namespace aul {
             return std::max(n, double_size);
         }
 
+        /// Ensures that there is space for at least n more elements
+        ///
+        /// \param n Number of elements about to be added
+        void reserve_additional(const size_type n) {
+            if (max_size() - size() - retired_anchor_count < n) {
+                throw std::length_error("aul::Slot_map grew beyond max size");
+            }
+
+            if (capacity() - size() - retired_anchor_count < n) {
+                reserve(grow_size(size() + retired_anchor_count + n));
+            }
+        }
+
         /// Returns the index associated with the element pointed to by ptr
         ///
         /// \param Pointer to element in element array
         [[nodiscard]]
         md_pointer metadata_of(const_pointer ptr) const noexcept {
-            return allocation.metadata + allocation.metadata[ptr - allocation.elements].anchor;
+            return allocation.metadata + allocation.metadata[ptr - allocation.elements].anchor_index;
         }
 
         //=================================================
@@ -777,17 +1312,100 @@ namespace aul {
         }
 
         /// Frees index pointed to by ptr and pushes it onto list of free
-        /// indices. Increments index version.
+        /// indices. Increments index version. If the next version could not
+        /// be represented by key_type, the anchor is retired instead.
         ///
         void release_anchor(const md_pointer ptr) noexcept {
+            if (key_type::max_version - 1 <= ptr->anchor.version()) {
+                ptr->anchor.version() = key_type::max_version;
+                ++retired_anchor_count;
+                return;
+            }
+
             if (free_anchor) {
-                *ptr = free_anchor - allocation.metadata;
+                ptr->anchor = size_type(free_anchor - allocation.metadata);
             } else {
-                *ptr = ptr - allocation.metadata;
+                ptr->anchor = size_type(ptr - allocation.metadata);
             }
             free_anchor = ptr;
         }
 
+        /// Moves every element whose anchor is marked unplaced to its final
+        /// position by following the cycles of the permutation.
+        ///
+        /// \param permutation Permutation of [0, size())
+        /// \param dest Set to the position currently being filled
+        /// \param temp_anchor Set to the anchor of the element held aside
+        /// for the current cycle
+        void place_cycles(aul::Span<const size_type> permutation, size_type& dest, size_type& temp_anchor) {
+            constexpr size_type unplaced = std::numeric_limits<size_type>::max();
+
+            for (size_type start = 0; start != elem_count; ++start) {
+                if (allocation.metadata[allocation.metadata[start].anchor_index].anchor.data() != unplaced) {
+                    continue;
+                }
+
+                dest = start;
+                temp_anchor = allocation.metadata[start].anchor_index;
+                T temp = std::move(allocation.elements[start]);
+
+                for (size_type src = permutation[dest]; src != start; src = permutation[dest]) {
+                    allocation.elements[dest] = std::move(allocation.elements[src]);
+                    place_anchor(dest, allocation.metadata[src].anchor_index);
+                    dest = src;
+                }
+
+                allocation.elements[dest] = std::move(temp);
+                place_anchor(dest, temp_anchor);
+            }
+        }
+
+        /// Records that the element anchored by anchor_index is now at pos
+        ///
+        /// \param pos Position of element
+        /// \param anchor_index Index of element's anchor
+        void place_anchor(const size_type pos, const size_type anchor_index) noexcept {
+            allocation.metadata[pos].anchor_index = anchor_index;
+            allocation.metadata[anchor_index].anchor.data() = pos;
+        }
+
+        /// Takes n anchors off the free list in a single pass and points them
+        /// at the n consecutive positions starting at pos.
+        ///
+        /// \pre At least n anchors must be on the free list
+        /// \tparam Out_iter Output iterator type accepting key_type
+        /// \param pos Position of first element to anchor
+        /// \param n Number of anchors to consume
+        /// \param keys Iterator to beginning of range to write keys to
+        /// \return Iterator to end of range of written keys
+        template<class Out_iter>
+        Out_iter consume_anchors(const size_type pos, const size_type n, Out_iter keys) noexcept {
+            if (n == 0) {
+                return keys;
+            }
+
+            size_type anchor_index = free_anchor - allocation.metadata;
+            size_type next_index = anchor_index;
+            for (size_type i = 0; i != n; ++i) {
+                md_pointer md = allocation.metadata + anchor_index;
+                next_index = md->anchor.data();
+
+                md->anchor.data() = pos + i;
+                allocation.metadata[pos + i].anchor_index = anchor_index;
+
+                *keys = key_type{anchor_index, md->anchor.version()};
+                ++keys;
+
+                anchor_index = next_index;
+            }
+
+            //The last consumed anchor pointing to itself terminated the list
+            const size_type last_index = allocation.metadata[pos + n - 1].anchor_index;
+            free_anchor = (next_index == last_index) ? nullptr : allocation.metadata + next_index;
+
+            return keys;
+        }
+
         //=================================================
         // Element helper methods
         //=================================================
@@ -931,6 +1549,14 @@ namespace aul {
         }
 
         void deallocate(Allocation& a) {
+            #if defined(__linux__)
+            if (a.image) {
+                ::munmap(a.image, a.image_size);
+                a = {};
+                return;
+            }
+            #endif
+
             auto md_allocator = md_allocator_type{allocator};
 
             allocator_traits::deallocate(allocator, a.elements, a.capacity);
@@ -939,33 +1565,287 @@ namespace aul {
             a = {};
         }
 
-    };
-
-    template<class T, class A>
-    class Slot_map<T, A>::Allocation {
-    public:
+        //=================================================
+        // Key validation helper methods
+        //=================================================
 
-        //=============================================
-        // Instance variables
-        //=============================================
+        ///
+        /// True if keys and anchor versions are laid out such that anchor
+        /// versions can be fetched using 64-bit vector gathers
+        ///
+        static constexpr bool is_gatherable =
+            std::is_same<key_type, Slot_map_key<size_type>>::value &&
+            sizeof(size_type) == 8 &&
+            sizeof(key_type) == 16;
 
-        md_pointer metadata = nullptr;
-        pointer elements = nullptr;
+        ///
+        /// \param keys Pointer to keys to validate
+        /// \param n Number of keys to validate. Must not exceed 64
+        /// \return Bitmask where bit i is set if keys[i] maps to a valid
+        ///     element
+        [[nodiscard]]
+        std::uint64_t validate_keys(const key_type* keys, const std::size_t n) const noexcept {
+            std::uint64_t ret = 0;
+            std::size_t i = 0;
+
+            #if defined(__AVX512F__) || defined(__AVX2__)
+            if constexpr (is_gatherable) {
+                if (allocation.capacity) {
+                    //Anchor versions are gathered relative to the first
+                    //anchor's version, using byte offsets of index * stride
+                    auto& first = const_cast<Metadata&>(*allocation.metadata);
+                    const auto* versions = reinterpret_cast<const long long*>(&first.anchor.version());
+
+                    constexpr long long stride = sizeof(Metadata);
+                    const auto* key_words = reinterpret_cast<const long long*>(keys);
+
+                    #if defined(__AVX512F__)
+                    const __m512i capacity = _mm512_set1_epi64(static_cast<long long>(allocation.capacity));
+                    const __m512i strides = _mm512_set1_epi64(stride);
+                    const __m512i even = _mm512_setr_epi64(0, 2, 4, 6, 8, 10, 12, 14);
+                    const __m512i odd = _mm512_setr_epi64(1, 3, 5, 7, 9, 11, 13, 15);
+
+                    for (; i + 8 <= n; i += 8) {
+                        const __m512i lo = _mm512_loadu_si512(key_words + 2 * i);
+                        const __m512i hi = _mm512_loadu_si512(key_words + 2 * i + 8);
+
+                        const __m512i indices = _mm512_permutex2var_epi64(lo, even, hi);
+                        const __m512i key_versions = _mm512_permutex2var_epi64(lo, odd, hi);
+
+                        const __mmask8 in_bounds = _mm512_cmplt_epu64_mask(indices, capacity);
+
+                        const __m512i offsets = _mm512_add_epi64(
+                            _mm512_mul_epu32(indices, strides),
+                            _mm512_slli_epi64(_mm512_mul_epu32(_mm512_srli_epi64(indices, 32), strides), 32)
+                        );
+
+                        const __m512i anchor_versions = _mm512_mask_i64gather_epi64(_mm512_setzero_si512(), in_bounds, offsets, versions, 1);
+                        const __mmask8 matches = _mm512_mask_cmpeq_epu64_mask(in_bounds, anchor_versions, key_versions);
+
+                        ret |= std::uint64_t(matches) << i;
+                    }
+                    #else
+                    const __m256i sign = _mm256_set1_epi64x(std::numeric_limits<long long>::min());
+                    const __m256i capacity = _mm256_xor_si256(_mm256_set1_epi64x(static_cast<long long>(allocation.capacity)), sign);
+                    const __m256i strides = _mm256_set1_epi64x(stride);
+
+                    for (; i + 4 <= n; i += 4) {
+                        const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key_words + 2 * i));
+                        const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(key_words + 2 * i + 4));
+
+                        //Unpacking yields keys in the order 0, 2, 1, 3
+                        const __m256i indices = _mm256_permute4x64_epi64(_mm256_unpacklo_epi64(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+                        const __m256i key_versions = _mm256_permute4x64_epi64(_mm256_unpackhi_epi64(lo, hi), _MM_SHUFFLE(3, 1, 2, 0));
+
+                        //AVX2 lacks unsigned comparisons so sign bits are flipped
+                        const __m256i in_bounds = _mm256_cmpgt_epi64(capacity, _mm256_xor_si256(indices, sign));
+
+                        const __m256i offsets = _mm256_add_epi64(
+                            _mm256_mul_epu32(indices, strides),
+                            _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(indices, 32), strides), 32)
+                        );
+
+                        const __m256i anchor_versions = _mm256_mask_i64gather_epi64(_mm256_setzero_si256(), versions, offsets, in_bounds, 1);
+                        const __m256i matches = _mm256_and_si256(in_bounds, _mm256_cmpeq_epi64(anchor_versions, key_versions));
+
+                        ret |= std::uint64_t(_mm256_movemask_pd(_mm256_castsi256_pd(matches))) << i;
+                    }
+                    #endif
+                }
+            }
+            #endif
 
-        size_type capacity = 0;
+            for (; i < n; ++i) {
+                ret |= std::uint64_t(contains(keys[i])) << i;
+            }
 
-        //=============================================
-        // -ctors
-        //=============================================
+            return ret;
+        }
 
-        Allocation() = default;
+        ///
+        /// \param keys Keys to resolve
+        /// \param out Pointer to array to write element pointers into
+        template<class P>
+        void resolve_keys(aul::Span<const key_type> keys, P* out) const noexcept {
+            for (std::size_t i = 0; i < keys.size(); i += 64) {
+                const std::size_t n = std::min<std::size_t>(64, keys.size() - i);
+                const std::uint64_t valid = validate_keys(keys.data() + i, n);
+
+                for (std::size_t j = 0; j < n; ++j) {
+                    if ((valid >> j) & 0x01) {
+                        out[i + j] = P(allocation.elements + allocation.metadata[keys[i + j].index].anchor.data());
+                    } else {
+                        out[i + j] = nullptr;
+                    }
+                }
+            }
+        }
+
+        //=================================================
+        // Image helper methods
+        //=================================================
+
+        #if defined(__linux__)
+
+        ///
+        /// \param capacity Capacity of container being described
+        /// \param size Size of container being described
+        /// \return Image header describing a container with this object's
+        ///     layout
+        [[nodiscard]]
+        static Image_header make_image_header(const std::uint64_t capacity, const std::uint64_t size) noexcept {
+            const auto align_up = [] (std::uint64_t x, std::uint64_t alignment) {
+                return (x + alignment - 1) / alignment * alignment;
+            };
+
+            Image_header header{};
+            header.element_size = sizeof(T);
+            header.metadata_size = sizeof(Metadata);
+            header.capacity = capacity;
+            header.size = size;
+            header.elements_offset = align_up(sizeof(Image_header), alignof(T));
+            header.metadata_offset = align_up(header.elements_offset + capacity * sizeof(T), alignof(Metadata));
+
+            return header;
+        }
+
+        ///
+        /// \return Image header describing this object
+        [[nodiscard]]
+        Image_header make_image_header() const noexcept {
+            Image_header header = make_image_header(allocation.capacity, elem_count);
+            header.free_anchor = free_anchor ? std::uint64_t(free_anchor - allocation.metadata) : Image_header::null_index;
+            header.retired_anchor_count = retired_anchor_count;
+
+            return header;
+        }
+
+        ///
+        /// Checks that an image's metadata describes a usable container: each
+        /// element's anchor points back at it, the free list stays in bounds
+        /// and terminates, and every remaining anchor is accounted for by the
+        /// retired anchor count.
+        ///
+        /// \param metadata Image's metadata array
+        /// \param header Image's header. The capacity, size and free anchor
+        ///     must already have been checked against the file
+        /// \return True if the metadata is consistent
+        [[nodiscard]]
+        static bool is_image_metadata_consistent(const Metadata* metadata, const Image_header& header) noexcept {
+            for (std::uint64_t i = 0; i < header.capacity; ++i) {
+                if (header.capacity <= metadata[i].anchor_index) {
+                    return false;
+                }
+            }
+
+            for (std::uint64_t i = 0; i < header.size; ++i) {
+                if (metadata[metadata[i].anchor_index].anchor.data() != i) {
+                    return false;
+                }
+            }
+
+            //Anchors of elements are exactly those which point at an element
+            //that points back at them
+            const auto is_in_use = [&] (const std::uint64_t anchor_index) {
+                const std::uint64_t pos = metadata[anchor_index].anchor.data();
+                return pos < header.size && metadata[pos].anchor_index == anchor_index;
+            };
+
+            //The list ends at an anchor which points to itself. Walking no
+            //more than the unused anchors rejects cycles.
+            std::uint64_t free_count = 0;
+            std::uint64_t anchor_index = header.free_anchor;
+            while (anchor_index != Image_header::null_index) {
+                if (free_count == header.capacity - header.size || is_in_use(anchor_index)) {
+                    return false;
+                }
+                ++free_count;
+
+                const std::uint64_t next = metadata[anchor_index].anchor.data();
+                if (next == anchor_index) {
+                    break;
+                }
+
+                if (header.capacity <= next) {
+                    return false;
+                }
+                anchor_index = next;
+            }
+
+            return header.retired_anchor_count == header.capacity - header.size - free_count;
+        }
+
+        ///
+        /// Writes n bytes to fd, retrying on partial writes
+        ///
+        /// \param fd File descriptor
+        /// \param bytes Bytes to write. Zeros are written if nullptr
+        /// \param n Number of bytes to write
+        /// \param written Running count of bytes written. Incremented by n
+        static void write_image_bytes(const int fd, const void* bytes, std::size_t n, std::size_t& written) {
+            static constexpr unsigned char zeros[4096]{};
+
+            auto* src = static_cast<const unsigned char*>(bytes);
+            while (n) {
+                const std::size_t chunk = src ? n : std::min(n, sizeof(zeros));
+                const ssize_t result = ::write(fd, src ? src : zeros, chunk);
+
+                if (result == -1) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+
+                    throw std::system_error(errno, std::generic_category(), "aul::Slot_map::write_image() failed");
+                }
+
+                if (src) {
+                    src += result;
+                }
+
+                n -= static_cast<std::size_t>(result);
+                written += static_cast<std::size_t>(result);
+            }
+        }
+
+        #endif
+
+    };
+
+    template<class T, class A, class K>
+    class Slot_map<T, A, K>::Allocation {
+    public:
+
+        //=============================================
+        // Instance variables
+        //=============================================
+
+        md_pointer metadata = nullptr;
+        pointer elements = nullptr;
+
+        size_type capacity = 0;
+
+        ///
+        /// Base of memory-mapped image that metadata and elements point into.
+        /// nullptr if they were obtained from the allocator
+        ///
+        void* image = nullptr;
+
+        std::size_t image_size = 0;
+
+        //=============================================
+        // -ctors
+        //=============================================
+
+        Allocation() = default;
 
         Allocation(const Allocation&) = delete;
 
         Allocation(Allocation&& alloc) noexcept :
             metadata(std::move(alloc.metadata)),
             elements(std::move(alloc.elements)),
-            capacity(std::move(alloc.capacity)) {
+            capacity(std::move(alloc.capacity)),
+            image(alloc.image),
+            image_size(alloc.image_size) {
 
             alloc = {};
         }
@@ -984,17 +1864,52 @@ namespace aul {
 
             capacity = std::move(alloc.capacity);
 
+            image = alloc.image;
+            image_size = alloc.image_size;
+
             alloc.metadata = nullptr;
             alloc.elements = nullptr;
             alloc.capacity = 0;
+            alloc.image = nullptr;
+            alloc.image_size = 0;
 
             return *this;
         }
 
     };
 
-    template<class T, class A>
-    class Slot_map<T, A>::Metadata {
+    template<class T, class A, class K>
+    class Slot_map<T, A, K>::Image_header {
+    public:
+
+        //=============================================
+        // Static constants
+        //=============================================
+
+        static constexpr std::uint64_t null_index = std::numeric_limits<std::uint64_t>::max();
+
+        //=============================================
+        // Instance members
+        //=============================================
+
+        char magic[8] = {'A', 'U', 'L', 'S', 'L', 'O', 'T', '1'};
+
+        std::uint64_t element_size = 0;
+        std::uint64_t metadata_size = 0;
+
+        std::uint64_t capacity = 0;
+        std::uint64_t size = 0;
+
+        std::uint64_t free_anchor = null_index;
+        std::uint64_t retired_anchor_count = 0;
+
+        std::uint64_t elements_offset = 0;
+        std::uint64_t metadata_offset = 0;
+
+    };
+
+    template<class T, class A, class K>
+    class Slot_map<T, A, K>::Metadata {
     public:
 
         //=============================================
@@ -1031,6 +1946,858 @@ namespace aul {
 
     };
 
+
+    ///
+    /// Specialization of aul::Slot_map for tuples of two or more types which
+    /// stores each tuple member in its own array, i.e. a structure-of-arrays
+    /// layout.
+    ///
+    /// Iterating over one or two members therefore only touches the arrays
+    /// holding those members. Individual members may be accessed through
+    /// column(), and any subset of members through columns(), which return
+    /// aul::Span and aul::Multispan objects respectively. The iterators are
+    /// aul::Random_access_zipper_iterator objects over all member arrays.
+    ///
+    /// Keys behave exactly as they do for the general template. Insertion and
+    /// erasure keep all arrays in sync.
+    ///
+    /// \tparam T0 First member type
+    /// \tparam T1 Second member type
+    /// \tparam Ts Remaining member types
+    /// \tparam A Allocator type. Rebound for each member type
+    /// \tparam K Key type
+    template<class T0, class T1, class...Ts, class A, class K>
+    class Slot_map<std::tuple<T0, T1, Ts...>, A, K> {
+
+        //=================================================
+        // Helper classes
+        //=================================================
+
+        class Metadata;
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        template<class U>
+        using column_allocator_type = typename std::allocator_traits<A>::template rebind_alloc<U>;
+
+        template<class U>
+        using column_allocator_traits = std::allocator_traits<column_allocator_type<U>>;
+
+        template<class U>
+        using column_pointer = typename column_allocator_traits<U>::pointer;
+
+        template<class U>
+        using const_column_pointer = typename column_allocator_traits<U>::const_pointer;
+
+    public:
+
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using value_type = std::tuple<T0, T1, Ts...>;
+        using key_type = K;
+
+        using reference = std::tuple<T0&, T1&, Ts&...>;
+        using const_reference = std::tuple<const T0&, const T1&, const Ts&...>;
+
+        using iterator = Random_access_zipper_iterator<
+            column_pointer<T0>,
+            column_pointer<T1>,
+            column_pointer<Ts>...
+        >;
+
+        using const_iterator = Random_access_zipper_iterator<
+            const_column_pointer<T0>,
+            const_column_pointer<T1>,
+            const_column_pointer<Ts>...
+        >;
+
+        template<std::size_t I>
+        using column_type = typename std::tuple_element<I, value_type>::type;
+
+        static constexpr std::size_t column_count = 2 + sizeof...(Ts);
+
+    private:
+
+        using md_allocator_type = column_allocator_type<Metadata>;
+        using md_allocator_traits = std::allocator_traits<md_allocator_type>;
+        using md_pointer = typename md_allocator_traits::pointer;
+
+        using columns_type = std::tuple<column_pointer<T0>, column_pointer<T1>, column_pointer<Ts>...>;
+
+        using column_indices = std::make_index_sequence<column_count>;
+
+        static constexpr size_type null_index = std::numeric_limits<size_type>::max();
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+    public:
+
+        ///
+        /// Default constructor
+        ///
+        Slot_map() noexcept(noexcept(allocator_type{})) = default;
+
+        ///
+        /// \param alloc Allocator to copy-construct internal allocators from
+        ///
+        explicit Slot_map(const allocator_type& alloc):
+            allocator(alloc) {}
+
+        ///
+        /// \param right Source object
+        ///
+        Slot_map(Slot_map&& right) noexcept:
+            allocator(std::move(right.allocator)),
+            column_arrays(std::exchange(right.column_arrays, columns_type{})),
+            metadata(std::exchange(right.metadata, nullptr)),
+            allocation_capacity(std::exchange(right.allocation_capacity, 0)),
+            elem_count(std::exchange(right.elem_count, 0)),
+            free_anchor(std::exchange(right.free_anchor, null_index)),
+            retired_anchor_count(std::exchange(right.retired_anchor_count, 0)) {}
+
+        ///
+        /// \param src Source object
+        ///
+        Slot_map(const Slot_map& src):
+            Slot_map(src, std::allocator_traits<A>::select_on_container_copy_construction(src.allocator)) {}
+
+        ///
+        /// \param src Source object
+        /// \param alloc Source for copy-construction of internal allocator
+        Slot_map(const Slot_map& src, const allocator_type& alloc):
+            allocator(alloc) {
+
+            reserve(src.allocation_capacity);
+            std::copy(src.metadata, src.metadata + allocation_capacity, metadata);
+            free_anchor = src.free_anchor;
+            retired_anchor_count = src.retired_anchor_count;
+
+            try {
+                for (; elem_count != src.elem_count; ++elem_count) {
+                    construct_columns(elem_count, src.get(elem_count));
+                }
+            } catch (...) {
+                clear();
+                throw;
+            }
+        }
+
+        ///
+        /// Destructor
+        ///
+        ~Slot_map() {
+            clear();
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        ///
+        /// \param  src
+        /// \return Current object
+        Slot_map& operator=(const Slot_map& src) {
+            if (this == &src) {
+                return *this;
+            }
+
+            if constexpr (std::allocator_traits<A>::propagate_on_container_copy_assignment::value) {
+                Slot_map temp{src, src.allocator};
+                clear();
+                allocator = src.allocator;
+                swap_contents(temp);
+            } else {
+                Slot_map temp{src, allocator};
+                swap_contents(temp);
+            }
+
+            return *this;
+        }
+
+        /// Move assignment operator
+        /// \param src Target object to move from
+        /// \return Current object
+        Slot_map& operator=(Slot_map&& src) noexcept(aul::is_noexcept_movable_v<A>) {
+            if (this == &src) {
+                return *this;
+            }
+
+            clear();
+
+            if constexpr (std::allocator_traits<A>::propagate_on_container_move_assignment::value) {
+                allocator = std::move(src.allocator);
+            } else if (allocator != src.allocator) {
+                reserve(src.allocation_capacity);
+                std::copy(src.metadata, src.metadata + allocation_capacity, metadata);
+                free_anchor = src.free_anchor;
+                retired_anchor_count = src.retired_anchor_count;
+
+                for (; elem_count != src.elem_count; ++elem_count) {
+                    move_construct_columns(elem_count, src, elem_count, column_indices{});
+                }
+
+                src.clear();
+                return *this;
+            }
+
+            swap_contents(src);
+            return *this;
+        }
+
+        //=================================================
+        // Modifier methods
+        //=================================================
+
+        ///
+        /// Destructs current contents. Reduces capacity to 0. All keys are
+        /// invalidated.
+        ///
+        void clear() noexcept {
+            destroy_columns(0, elem_count, column_indices{});
+
+            if (allocation_capacity) {
+                md_allocator_type md_allocator{allocator};
+                aul::destroy(metadata, metadata + allocation_capacity, md_allocator);
+                md_allocator_traits::deallocate(md_allocator, metadata, allocation_capacity);
+                deallocate_columns(column_arrays, allocation_capacity, column_indices{});
+            }
+
+            column_arrays = columns_type{};
+            metadata = nullptr;
+            allocation_capacity = 0;
+            elem_count = 0;
+            free_anchor = null_index;
+            retired_anchor_count = 0;
+        }
+
+        /// Replaces the contents of the current object those of src. Also swaps
+        /// allocators if necessary.
+        ///
+        /// \param src Target object to swap with
+        ///
+        void swap(Slot_map& src) noexcept (aul::is_noexcept_swappable_v<A>) {
+            if constexpr (std::allocator_traits<A>::propagate_on_container_swap::value) {
+                std::swap(allocator, src.allocator);
+            }
+
+            swap_contents(src);
+        }
+
+        ///
+        /// \param l Left map to swap
+        /// \param r Right map to swap
+        ///
+        friend void swap(Slot_map& l, Slot_map& r) noexcept (aul::is_noexcept_swappable_v<A>) {
+            l.swap(r);
+        }
+
+        //=================================================
+        // Element access operators/methods
+        //=================================================
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Tuple of references to members of element mapped to key
+        [[nodiscard]]
+        reference operator[](const key_type key) noexcept {
+            return get(metadata[key.index].anchor.data());
+        }
+
+        ///
+        /// Undefined behavior if key is not valid
+        ///
+        /// \param key Key mapped to desired element
+        /// \return    Tuple of references to members of element mapped to key
+        [[nodiscard]]
+        const_reference operator[](const key_type key) const noexcept {
+            return get(metadata[key.index].anchor.data());
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Tuple of references to members of element mapped to key
+        ///
+        [[nodiscard]]
+        reference at(const key_type key) {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        /// \param key Key mapped to desired element
+        /// \return    Tuple of references to members of element mapped to key
+        ///
+        [[nodiscard]]
+        const_reference at(const key_type key) const {
+            if (!contains(key)) {
+                throw std::runtime_error("aul::Slot_map::at() called with invalid key");
+            }
+
+            return operator[](key);
+        }
+
+        ///
+        /// \tparam I Index of member
+        /// \return Span over the I'th member of all elements
+        template<std::size_t I>
+        [[nodiscard]]
+        aul::Span<column_type<I>> column() noexcept {
+            if (empty()) {
+                return {};
+            }
+
+            return aul::Span<column_type<I>>{elem_count, std::get<I>(column_arrays)};
+        }
+
+        ///
+        /// \tparam I Index of member
+        /// \return Span over the I'th member of all elements
+        template<std::size_t I>
+        [[nodiscard]]
+        aul::Span<const column_type<I>> column() const noexcept {
+            if (empty()) {
+                return {};
+            }
+
+            return aul::Span<const column_type<I>>{elem_count, std::get<I>(column_arrays)};
+        }
+
+        ///
+        /// \tparam Is Indices of members
+        /// \return Multispan over the specified members of all elements
+        template<std::size_t...Is>
+        [[nodiscard]]
+        aul::Multispan<column_type<Is>...> columns() noexcept {
+            if (empty()) {
+                return {};
+            }
+
+            return aul::Multispan<column_type<Is>...>{elem_count, std::get<Is>(column_arrays)...};
+        }
+
+        ///
+        /// \tparam Is Indices of members
+        /// \return Multispan over the specified members of all elements
+        template<std::size_t...Is>
+        [[nodiscard]]
+        aul::Multispan<const column_type<Is>...> columns() const noexcept {
+            if (empty()) {
+                return {};
+            }
+
+            return aul::Multispan<const column_type<Is>...>{elem_count, std::get<Is>(column_arrays)...};
+        }
+
+        //=================================================
+        // Element addition
+        //=================================================
+
+        /// Constructs each member of a new element from the corresponding
+        /// argument
+        ///
+        /// \tparam Args Argument types. One per member
+        /// \param args  Arguments to construct members from
+        /// \return      Key mapped to new element
+        template<class... Args>
+        key_type emplace(Args&&...args) {
+            static_assert(sizeof...(Args) == column_count, "Exactly one argument per member must be specified");
+
+            reserve_additional(1);
+            construct_columns(elem_count, std::forward_as_tuple(std::forward<Args>(args)...));
+
+            const size_type anchor_index = consume_anchor(elem_count);
+            ++elem_count;
+
+            return key_type{anchor_index, metadata[anchor_index].anchor.version()};
+        }
+
+        ///
+        /// \param v Tuple to copy members from
+        /// \return  Key mapped to new element
+        key_type insert(const value_type& v) {
+            return std::apply([this] (const auto&...members) { return emplace(members...); }, v);
+        }
+
+        ///
+        /// \param v Tuple to move members from
+        /// \return  Key mapped to new element
+        key_type insert(value_type&& v) {
+            return std::apply([this] (auto&...members) { return emplace(std::move(members)...); }, v);
+        }
+
+        //=================================================
+        // Element removal
+        //=================================================
+
+        ///
+        /// \param key Key mapping to element to remove
+        /// \return True if an element was removed
+        bool erase(const key_type key) noexcept {
+            if (!contains(key)) {
+                return false;
+            }
+
+            erase_at(metadata[key.index].anchor.data());
+            return true;
+        }
+
+        ///
+        /// \param it Valid iterator to element to erase
+        ///
+        void erase(const_iterator it) noexcept {
+            erase_at(static_cast<size_type>(it - cbegin()));
+        }
+
+        //=================================================
+        // Iterator methods
+        //=================================================
+
+        [[nodiscard]]
+        iterator begin() noexcept {
+            return std::make_from_tuple<iterator>(column_arrays);
+        }
+
+        [[nodiscard]]
+        const_iterator begin() const noexcept {
+            return std::make_from_tuple<const_iterator>(column_arrays);
+        }
+
+        [[nodiscard]]
+        const_iterator cbegin() const noexcept {
+            return begin();
+        }
+
+        [[nodiscard]]
+        iterator end() noexcept {
+            return begin() + elem_count;
+        }
+
+        [[nodiscard]]
+        const_iterator end() const noexcept {
+            return begin() + elem_count;
+        }
+
+        [[nodiscard]]
+        const_iterator cend() const noexcept {
+            return end();
+        }
+
+        //=================================================
+        // Size & capacity methods
+        //=================================================
+
+        ///
+        /// \return True if container has no elements
+        ///
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return elem_count == 0;
+        }
+
+        ///
+        /// \return Allocation capacity
+        ///
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation_capacity;
+        }
+
+        ///
+        /// \return Element count
+        ///
+        [[nodiscard]]
+        size_type size() const noexcept {
+            return elem_count;
+        }
+
+        ///
+        /// \return Maximum capacity container may reach.
+        ///
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            constexpr size_type size_type_max = std::numeric_limits<difference_type>::max();
+            constexpr size_type bytes_per_element = aul::sizeof_sum<T0, T1, Ts...>::value + sizeof(Metadata);
+
+            return std::min({size_type_max, size_type(-1) / bytes_per_element, size_type(key_type::max_index)});
+        }
+
+        ///
+        /// Allocates enough memory to store n elements. Each member array is
+        /// reallocated and its contents moved.
+        ///
+        /// \param n Number of elements to allocate memory for
+        ///
+        void reserve(const size_type n) {
+            if (n <= capacity()) {
+                return;
+            }
+
+            if (max_size() < n) {
+                throw std::length_error("aul::Slot_map grew beyond max size");
+            }
+
+            md_allocator_type md_allocator{allocator};
+
+            columns_type new_columns{};
+            allocate_columns(new_columns, n);
+
+            md_pointer new_metadata;
+            try {
+                new_metadata = md_allocator_traits::allocate(md_allocator, n);
+            } catch (...) {
+                deallocate_columns(new_columns, n, column_indices{});
+                throw;
+            }
+
+            relocate_columns(new_columns, column_indices{});
+
+            //Move existing metadata then chain new anchors onto the free list
+            for (size_type i = 0; i != allocation_capacity; ++i) {
+                md_allocator_traits::construct(md_allocator, new_metadata + i, std::move(metadata[i]));
+                md_allocator_traits::destroy(md_allocator, metadata + i);
+            }
+
+            for (size_type i = allocation_capacity; i != n - 1; ++i) {
+                md_allocator_traits::construct(md_allocator, new_metadata + i, i + 1);
+            }
+
+            const size_type last_next = (free_anchor == null_index) ? n - 1 : free_anchor;
+            md_allocator_traits::construct(md_allocator, new_metadata + n - 1, last_next);
+
+            if (allocation_capacity) {
+                md_allocator_traits::deallocate(md_allocator, metadata, allocation_capacity);
+                deallocate_columns(column_arrays, allocation_capacity, column_indices{});
+            }
+
+            free_anchor = allocation_capacity;
+            column_arrays = new_columns;
+            metadata = new_metadata;
+            allocation_capacity = n;
+        }
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        [[nodiscard]]
+        friend bool operator==(const Slot_map& lhs, const Slot_map& rhs) {
+            if (lhs.size() != rhs.size()) {
+                return false;
+            }
+
+            for (size_type i = 0; i != lhs.size(); ++i) {
+                if (lhs.get(i) != rhs.get(i)) {
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        [[nodiscard]]
+        friend bool operator!=(const Slot_map& lhs, const Slot_map& rhs) {
+            return !operator==(lhs, rhs);
+        }
+
+        //=================================================
+        // Misc. methods
+        //=================================================
+
+        /// \param it Iterator to element
+        /// \return   key corresponding to element pointed to be it
+        ///
+        [[nodiscard]]
+        key_type get_key(const_iterator it) const noexcept {
+            const size_type anchor_index = metadata[it - cbegin()].anchor_index;
+            return key_type{anchor_index, metadata[anchor_index].anchor.version()};
+        }
+
+        /// \param key Key to be checked
+        /// \return    Returns true if the key maps to a valid element
+        ///
+        [[nodiscard]]
+        bool contains(const key_type key) const noexcept {
+            return (key.index < allocation_capacity) && (key.version == metadata[key.index].anchor.version());
+        }
+
+        ///
+        /// \return Copy of internal allocator
+        ///
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return allocator;
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        allocator_type allocator{};
+
+        columns_type column_arrays{};
+
+        md_pointer metadata = nullptr;
+
+        size_type allocation_capacity = 0;
+
+        size_type elem_count = 0;
+
+        size_type free_anchor = null_index;
+
+        ///
+        /// Number of anchors whose versions were exhausted and which will
+        /// therefore never be reused
+        ///
+        size_type retired_anchor_count = 0;
+
+        //=================================================
+        // Misc. helper methods
+        //=================================================
+
+        /// Ensures that there is space for at least n more elements
+        ///
+        /// \param n Number of elements about to be added
+        void reserve_additional(const size_type n) {
+            if (max_size() - size() - retired_anchor_count < n) {
+                throw std::length_error("aul::Slot_map grew beyond max size");
+            }
+
+            if (capacity() - size() - retired_anchor_count < n) {
+                const size_type double_size = (max_size() / 2) < capacity() ? max_size() : 2 * capacity();
+                reserve(std::max(size() + retired_anchor_count + n, double_size));
+            }
+        }
+
+        ///
+        /// \param pos Position of element
+        /// \return Tuple of references to members of element at pos
+        [[nodiscard]]
+        reference get(const size_type pos) noexcept {
+            return std::apply([pos] (auto...ptrs) { return reference{ptrs[pos]...}; }, column_arrays);
+        }
+
+        ///
+        /// \param pos Position of element
+        /// \return Tuple of references to members of element at pos
+        [[nodiscard]]
+        const_reference get(const size_type pos) const noexcept {
+            return std::apply([pos] (auto...ptrs) { return const_reference{ptrs[pos]...}; }, column_arrays);
+        }
+
+        ///
+        /// Moves the last element into position pos, in every member array,
+        /// and releases the anchor of the element at pos
+        ///
+        /// \param pos Position of element to erase
+        void erase_at(const size_type pos) noexcept {
+            const size_type last = elem_count - 1;
+            const size_type anchor_index = metadata[pos].anchor_index;
+
+            if (pos != last) {
+                move_assign_columns(pos, last, column_indices{});
+
+                const size_type moved_anchor = metadata[last].anchor_index;
+                metadata[pos].anchor_index = moved_anchor;
+                metadata[moved_anchor].anchor.data() = pos;
+            }
+
+            destroy_columns(last, elem_count, column_indices{});
+            release_anchor(anchor_index);
+            --elem_count;
+        }
+
+        //=================================================
+        // Anchor helper methods
+        //=================================================
+
+        /// Takes an anchor off the free list and points it at pos
+        ///
+        /// \pre The free list must not be empty
+        /// \param pos Position of element to anchor
+        /// \return Index of consumed anchor
+        size_type consume_anchor(const size_type pos) noexcept {
+            const size_type anchor_index = free_anchor;
+            md_pointer md = metadata + anchor_index;
+
+            //An anchor which points to itself terminates the list
+            const size_type next = md->anchor.data();
+            free_anchor = (next == anchor_index) ? null_index : next;
+
+            md->anchor.data() = pos;
+            metadata[pos].anchor_index = anchor_index;
+
+            return anchor_index;
+        }
+
+        /// Pushes the anchor at anchor_index onto the free list. Increments
+        /// the anchor's version. If the next version could not be represented
+        /// by key_type, the anchor is retired instead.
+        ///
+        void release_anchor(const size_type anchor_index) noexcept {
+            if (key_type::max_version - 1 <= metadata[anchor_index].anchor.version()) {
+                metadata[anchor_index].anchor.version() = key_type::max_version;
+                ++retired_anchor_count;
+                return;
+            }
+
+            metadata[anchor_index].anchor = (free_anchor == null_index) ? anchor_index : free_anchor;
+            free_anchor = anchor_index;
+        }
+
+        //=================================================
+        // Column helper methods
+        //=================================================
+
+        ///
+        /// Constructs the members of the element at pos from the elements of
+        /// args. If the construction of any member throws, the members which
+        /// were already constructed are destroyed.
+        ///
+        /// \tparam I Index of first member to construct
+        /// \param pos Position of element
+        /// \param args Tuple of arguments, one per member
+        template<std::size_t I = 0, class Tuple>
+        void construct_columns(const size_type pos, Tuple&& args) {
+            if constexpr (I != column_count) {
+                using U = column_type<I>;
+                column_allocator_type<U> alloc{allocator};
+
+                column_pointer<U> p = std::get<I>(column_arrays) + pos;
+                column_allocator_traits<U>::construct(alloc, aul::to_raw_pointer(p), std::get<I>(std::forward<Tuple>(args)));
+
+                try {
+                    construct_columns<I + 1>(pos, std::forward<Tuple>(args));
+                } catch (...) {
+                    column_allocator_traits<U>::destroy(alloc, aul::to_raw_pointer(p));
+                    throw;
+                }
+            }
+        }
+
+        template<std::size_t...Is>
+        void move_construct_columns(const size_type pos, Slot_map& src, const size_type src_pos, std::index_sequence<Is...>) {
+            construct_columns(pos, std::forward_as_tuple(std::move(std::get<Is>(src.column_arrays)[src_pos])...));
+        }
+
+        template<std::size_t...Is>
+        void move_assign_columns(const size_type to, const size_type from, std::index_sequence<Is...>) noexcept {
+            ((std::get<Is>(column_arrays)[to] = std::move(std::get<Is>(column_arrays)[from])), ...);
+        }
+
+        template<std::size_t...Is>
+        void destroy_columns(const size_type from, const size_type to, std::index_sequence<Is...>) noexcept {
+            ([&] () {
+                column_allocator_type<column_type<Is>> alloc{allocator};
+                aul::destroy(std::get<Is>(column_arrays) + from, std::get<Is>(column_arrays) + to, alloc);
+            }(), ...);
+        }
+
+        ///
+        /// Moves each member array into the corresponding array in
+        /// new_columns and destroys the originals
+        ///
+        template<std::size_t...Is>
+        void relocate_columns(columns_type& new_columns, std::index_sequence<Is...>) {
+            ([&] () {
+                column_allocator_type<column_type<Is>> alloc{allocator};
+                aul::uninitialized_move(std::get<Is>(column_arrays), std::get<Is>(column_arrays) + elem_count, std::get<Is>(new_columns), alloc);
+                aul::destroy(std::get<Is>(column_arrays), std::get<Is>(column_arrays) + elem_count, alloc);
+            }(), ...);
+        }
+
+        //=================================================
+        // Allocation helper methods
+        //=================================================
+
+        ///
+        /// Allocates arrays of n objects for member I and all subsequent
+        /// members. Provides the strong exception guarantee.
+        ///
+        template<std::size_t I = 0>
+        void allocate_columns(columns_type& cols, const size_type n) {
+            if constexpr (I != column_count) {
+                using U = column_type<I>;
+                column_allocator_type<U> alloc{allocator};
+
+                std::get<I>(cols) = column_allocator_traits<U>::allocate(alloc, n);
+
+                try {
+                    allocate_columns<I + 1>(cols, n);
+                } catch (...) {
+                    column_allocator_traits<U>::deallocate(alloc, std::get<I>(cols), n);
+                    throw;
+                }
+            }
+        }
+
+        template<std::size_t...Is>
+        void deallocate_columns(columns_type& cols, const size_type n, std::index_sequence<Is...>) noexcept {
+            ([&] () {
+                column_allocator_type<column_type<Is>> alloc{allocator};
+                column_allocator_traits<column_type<Is>>::deallocate(alloc, std::get<Is>(cols), n);
+            }(), ...);
+        }
+
+        ///
+        /// Swaps everything except for the allocator
+        ///
+        void swap_contents(Slot_map& src) noexcept {
+            std::swap(column_arrays, src.column_arrays);
+            std::swap(metadata, src.metadata);
+            std::swap(allocation_capacity, src.allocation_capacity);
+            std::swap(elem_count, src.elem_count);
+            std::swap(free_anchor, src.free_anchor);
+            std::swap(retired_anchor_count, src.retired_anchor_count);
+        }
+
+    };
+
+    template<class T0, class T1, class...Ts, class A, class K>
+    class Slot_map<std::tuple<T0, T1, Ts...>, A, K>::Metadata {
+    public:
+
+        //=============================================
+        // -ctors
+        //=============================================
+
+        Metadata() = default;
+
+        explicit Metadata(const size_type anchor):
+            anchor(anchor, 1) {}
+
+        Metadata(const Metadata&) = default;
+        Metadata(Metadata&&) = default;
+
+        ~Metadata() = default;
+
+        //=============================================
+        // Assignment operators
+        //=============================================
+
+        Metadata& operator=(const Metadata&) = default;
+        Metadata& operator=(Metadata&&) = default;
+
+        //=============================================
+        // Instance members
+        //=============================================
+
+        size_type anchor_index = 0;
+        aul::Versioned_type<size_type, size_type> anchor{0, 1};
+
+    };
+
 }
 
 #endif
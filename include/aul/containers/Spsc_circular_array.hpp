@@ -0,0 +1,419 @@
+#ifndef AUL_SPSC_CIRCULAR_ARRAY_HPP
+#define AUL_SPSC_CIRCULAR_ARRAY_HPP
+
+#include "Allocator_aware_base.hpp"
+
+#include "../memory/Allocation.hpp"
+#include "../memory/Memory.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+namespace aul {
+
+    ///
+    /// A fixed-capacity ring buffer which serves as a lock-free queue between
+    /// exactly one producer thread and exactly one consumer thread. Only the
+    /// producer may call the push methods and only the consumer may call the
+    /// pop methods.
+    ///
+    /// Capacity is rounded up to a power of two so that positions wrap with a
+    /// mask. The head and tail positions are free-running counters which each
+    /// live on a cache line of their own, next to the owning thread's cached
+    /// copy of the other counter. The two threads therefore only touch each
+    /// other's cache line when the cached copy suggests the ring is full or
+    /// empty.
+    ///
+    /// push_n() and pop_n() transfer elements as at most two contiguous
+    /// segments of the allocation, in the same way as aul::Circular_array
+    /// splits its elements into a first and second segment.
+    ///
+    /// \tparam T Element type
+    /// \tparam A Allocator type
+    template<class T, class A = std::allocator<T>>
+    class Spsc_circular_array : public Allocator_aware_base<A> {
+        using base = Allocator_aware_base<A>;
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+        using allocator_type = A;
+
+        using size_type = typename std::allocator_traits<A>::size_type;
+        using difference_type = typename std::allocator_traits<A>::difference_type;
+
+        using pointer = typename std::allocator_traits<A>::pointer;
+        using const_pointer = typename std::allocator_traits<A>::const_pointer;
+
+    private:
+
+        using allocation_type = aul::Allocation<value_type, allocator_type>;
+
+    public:
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        ///
+        /// \param n Minimum number of elements the ring must be able to hold.
+        ///     Rounded up to a power of two
+        /// \param alloc Allocator to copy
+        explicit Spsc_circular_array(const size_type n, const allocator_type& alloc = {}):
+            base(alloc) {
+
+            allocation = allocate(round_capacity(n));
+            mask = allocation.capacity - 1;
+        }
+
+        Spsc_circular_array(const Spsc_circular_array&) = delete;
+        Spsc_circular_array(Spsc_circular_array&&) = delete;
+
+        ///
+        /// Destroys all elements still in the ring. Neither thread may be
+        /// accessing the ring
+        ///
+        ~Spsc_circular_array() {
+            const size_type h = head.load(std::memory_order_acquire);
+            const size_type t = tail.load(std::memory_order_acquire);
+            destroy_elements(h, t - h);
+
+            deallocate(allocation);
+        }
+
+        //=================================================
+        // Assignment operators
+        //=================================================
+
+        Spsc_circular_array& operator=(const Spsc_circular_array&) = delete;
+        Spsc_circular_array& operator=(Spsc_circular_array&&) = delete;
+
+        //=================================================
+        // Producer methods
+        //=================================================
+
+        ///
+        /// Constructs a new element at the back of the ring if there is room
+        /// for it. Must only be called by the producer thread
+        ///
+        /// \tparam Args Argument types to element constructor
+        /// \param args Arguments to element constructor
+        /// \return True if the element was pushed. False if the ring was full
+        template<class...Args>
+        bool try_emplace(Args&&...args) {
+            const size_type t = tail.load(std::memory_order_relaxed);
+
+            if (t - cached_head == capacity()) {
+                cached_head = head.load(std::memory_order_acquire);
+                if (t - cached_head == capacity()) {
+                    return false;
+                }
+            }
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::construct(allocator, allocation.ptr + (t & mask), std::forward<Args>(args)...);
+
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        ///
+        /// Must only be called by the producer thread
+        ///
+        /// \param val Value to copy
+        /// \return True if the element was pushed. False if the ring was full
+        bool try_push(const T& val) {
+            return try_emplace(val);
+        }
+
+        ///
+        /// Must only be called by the producer thread
+        ///
+        /// \param val Value to move
+        /// \return True if the element was pushed. False if the ring was full
+        bool try_push(T&& val) {
+            return try_emplace(std::move(val));
+        }
+
+        ///
+        /// Copies as many elements from the range beginning at first as fit,
+        /// up to n, to the back of the ring, and publishes them to the
+        /// consumer at once. Must only be called by the producer thread.
+        ///
+        /// If copying an element throws, the elements of segments which were
+        /// copied completely remain pushed.
+        ///
+        /// \tparam R_iter Random access iterator type
+        /// \param first Iterator to beginning of range to copy
+        /// \param n Number of elements in range
+        /// \return Number of elements pushed
+        template<class R_iter>
+        size_type push_n(R_iter first, const size_type n) {
+            const size_type t = tail.load(std::memory_order_relaxed);
+
+            size_type available = capacity() - (t - cached_head);
+            if (available < n) {
+                cached_head = head.load(std::memory_order_acquire);
+                available = capacity() - (t - cached_head);
+            }
+
+            const size_type count = std::min(n, available);
+            if (!count) {
+                return 0;
+            }
+
+            auto allocator = get_allocator();
+            const auto segment0 = first_segment(t, count);
+            const auto segment1 = second_segment(t, count);
+
+            aul::uninitialized_copy_n(first, segment0.second, segment0.first, allocator);
+            try {
+                aul::uninitialized_copy_n(first + segment0.second, segment1.second, segment1.first, allocator);
+            } catch (...) {
+                tail.store(t + segment0.second, std::memory_order_release);
+                throw;
+            }
+
+            tail.store(t + count, std::memory_order_release);
+            return count;
+        }
+
+        //=================================================
+        // Consumer methods
+        //=================================================
+
+        ///
+        /// Move assigns the front element to out and removes it from the
+        /// ring. Must only be called by the consumer thread
+        ///
+        /// \param out Object to move front element to
+        /// \return True if an element was popped. False if the ring was empty
+        bool try_pop(T& out) {
+            const size_type h = head.load(std::memory_order_relaxed);
+
+            if (h == cached_tail) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                if (h == cached_tail) {
+                    return false;
+                }
+            }
+
+            pointer p = allocation.ptr + (h & mask);
+            out = std::move(*p);
+
+            auto allocator = get_allocator();
+            std::allocator_traits<A>::destroy(allocator, p);
+
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        ///
+        /// Moves up to n elements from the front of the ring to out, and
+        /// releases their slots to the producer at once. Must only be called
+        /// by the consumer thread.
+        ///
+        /// If moving an element throws, no elements are popped.
+        ///
+        /// \tparam Out Output iterator type
+        /// \param out Iterator to beginning of destination range
+        /// \param n Maximum number of elements to pop
+        /// \return Number of elements popped
+        template<class Out>
+        size_type pop_n(Out out, const size_type n) {
+            const size_type h = head.load(std::memory_order_relaxed);
+
+            size_type available = cached_tail - h;
+            if (available < n) {
+                cached_tail = tail.load(std::memory_order_acquire);
+                available = cached_tail - h;
+            }
+
+            const size_type count = std::min(n, available);
+            if (!count) {
+                return 0;
+            }
+
+            const auto segment0 = first_segment(h, count);
+            const auto segment1 = second_segment(h, count);
+
+            out = std::move(segment0.first, segment0.first + segment0.second, out);
+            std::move(segment1.first, segment1.first + segment1.second, out);
+
+            destroy_elements(h, count);
+
+            head.store(h + count, std::memory_order_release);
+            return count;
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// Only a snapshot if either thread is active
+        ///
+        /// \return Number of elements in the ring
+        [[nodiscard]]
+        size_type size() const noexcept {
+            const size_type h = head.load(std::memory_order_acquire);
+            const size_type t = tail.load(std::memory_order_acquire);
+            return t - h;
+        }
+
+        ///
+        /// Only a snapshot if either thread is active
+        ///
+        /// \return True if the ring holds no elements
+        [[nodiscard]]
+        bool empty() const noexcept {
+            return size() == 0;
+        }
+
+        ///
+        /// \return Number of elements the ring can hold. Always a power of two
+        [[nodiscard]]
+        size_type capacity() const noexcept {
+            return allocation.capacity;
+        }
+
+        ///
+        /// \return Copy of allocator used by container
+        [[nodiscard]]
+        allocator_type get_allocator() const {
+            return base::get_allocator();
+        }
+
+    private:
+
+        //=================================================
+        // Instance members
+        //=================================================
+
+        ///
+        /// Storage for elements. Never changes after construction
+        ///
+        allocation_type allocation{};
+
+        ///
+        /// capacity() - 1
+        ///
+        size_type mask{};
+
+        ///
+        /// Position one past the last element. Written only by the producer
+        ///
+        alignas(64) std::atomic<size_type> tail{0};
+
+        ///
+        /// Producer's last observed value of head
+        ///
+        size_type cached_head{0};
+
+        ///
+        /// Position of the first element. Written only by the consumer
+        ///
+        alignas(64) std::atomic<size_type> head{0};
+
+        ///
+        /// Consumer's last observed value of tail
+        ///
+        size_type cached_tail{0};
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        ///
+        /// \param n Requested capacity
+        /// \return Smallest power of two not less than n
+        [[nodiscard]]
+        size_type round_capacity(const size_type n) const {
+            const size_type max = std::min(
+                static_cast<size_type>(std::numeric_limits<difference_type>::max()),
+                std::allocator_traits<A>::max_size(get_allocator())
+            );
+
+            size_type ret = 1;
+            while (ret < n) {
+                if (max / 2 < ret) {
+                    throw std::length_error("aul::Spsc_circular_array constructed with excessive capacity");
+                }
+                ret *= 2;
+            }
+
+            return ret;
+        }
+
+        ///
+        /// \param position Free-running position of first element of region
+        /// \param n Number of elements in region. Not greater than capacity()
+        /// \return Pointer to, and length of, the part of the region which
+        ///     precedes the end of the allocation
+        [[nodiscard]]
+        std::pair<pointer, size_type> first_segment(const size_type position, const size_type n) const noexcept {
+            const size_type offset = position & mask;
+            return {allocation.ptr + offset, std::min(n, capacity() - offset)};
+        }
+
+        ///
+        /// \param position Free-running position of first element of region
+        /// \param n Number of elements in region. Not greater than capacity()
+        /// \return Pointer to, and length of, the part of the region which
+        ///     wraps around to the start of the allocation
+        [[nodiscard]]
+        std::pair<pointer, size_type> second_segment(const size_type position, const size_type n) const noexcept {
+            const size_type offset = position & mask;
+            return {allocation.ptr, n - std::min(n, capacity() - offset)};
+        }
+
+        ///
+        /// \param position Free-running position of first element to destroy
+        /// \param n Number of elements to destroy
+        void destroy_elements(const size_type position, const size_type n) noexcept {
+            auto allocator = get_allocator();
+
+            const auto segment0 = first_segment(position, n);
+            const auto segment1 = second_segment(position, n);
+
+            aul::destroy_n(segment0.first, segment0.second, allocator);
+            aul::destroy_n(segment1.first, segment1.second, allocator);
+        }
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        [[nodiscard]]
+        allocation_type allocate(const size_type n) {
+            allocation_type ret{};
+
+            auto allocator = get_allocator();
+            ret.ptr = std::allocator_traits<allocator_type>::allocate(allocator, n);
+            ret.capacity = n;
+
+            return ret;
+        }
+
+        void deallocate(allocation_type& alloc) noexcept {
+            if (alloc.ptr) {
+                auto allocator = get_allocator();
+                std::allocator_traits<allocator_type>::deallocate(allocator, alloc.ptr, alloc.capacity);
+            }
+
+            alloc = {};
+        }
+
+    };
+
+}
+
+#endif //AUL_SPSC_CIRCULAR_ARRAY_HPP
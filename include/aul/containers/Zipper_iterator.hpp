@@ -429,13 +429,15 @@ namespace aul {
         //=================================================
 
         Bidirectional_zipper_iterator& operator--() {
-            --base::it;
+            --base::it0;
+            --base::it1;
             return *this;
         }
 
         Bidirectional_zipper_iterator operator--(int) {
             auto tmp = *this;
-            --base::it;
+            --base::it0;
+            --base::it1;
             return tmp;
         }
 
@@ -507,20 +509,56 @@ namespace aul {
         // Comparison operators
         //=================================================
 
-        bool operator<(const Random_access_zipper_iterator& rhs) {
-            return (base::it < rhs.it);
+        bool operator==(const Random_access_zipper_iterator& rhs) const {
+            return (it == rhs.it) && base::operator==(rhs);
         }
 
-        bool operator>(const Random_access_zipper_iterator& rhs) {
-            return (base::it > rhs.it);
+        bool operator!=(const Random_access_zipper_iterator& rhs) const {
+            return (it != rhs.it) || base::operator!=(rhs);
+        }
+
+        bool operator<(const Random_access_zipper_iterator& rhs) const {
+            return (it < rhs.it);
         }
 
-        bool operator>=(const Random_access_zipper_iterator& rhs) {
-            return (base::it >= rhs.it);
+        bool operator>(const Random_access_zipper_iterator& rhs) const {
+            return (it > rhs.it);
+        }
+
+        bool operator>=(const Random_access_zipper_iterator& rhs) const {
+            return (it >= rhs.it);
         }
 
-        bool operator<=(const Random_access_zipper_iterator& rhs) {
-            return (base::it <= rhs.it);
+        bool operator<=(const Random_access_zipper_iterator& rhs) const {
+            return (it <= rhs.it);
+        }
+
+        //=================================================
+        // Increment/Decrement operators
+        //=================================================
+
+        Random_access_zipper_iterator& operator++() {
+            ++it;
+            base::operator++();
+            return *this;
+        }
+
+        Random_access_zipper_iterator operator++(int) {
+            auto tmp = *this;
+            operator++();
+            return tmp;
+        }
+
+        Random_access_zipper_iterator& operator--() {
+            --it;
+            base::operator--();
+            return *this;
+        }
+
+        Random_access_zipper_iterator operator--(int) {
+            auto tmp = *this;
+            operator--();
+            return tmp;
         }
 
         //=================================================
@@ -556,7 +594,7 @@ namespace aul {
 
         Random_access_zipper_iterator operator-(difference_type rhs) const {
             auto ret = *this;
-            ret.it0 -= rhs;
+            ret.it -= rhs;
             ret.base::operator-=(rhs);
             return ret;
         }
@@ -580,6 +618,13 @@ namespace aul {
             );
         }
 
+        pointer operator->() const {
+            return std::tuple_cat(
+                std::make_tuple(impl::arrow(it)),
+                base::operator->()
+            );
+        }
+
         reference operator[](difference_type d) const {
             auto tmp = *this;
             tmp += d;
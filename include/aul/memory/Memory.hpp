@@ -358,7 +358,7 @@ namespace aul {
             *(--d_last) = std::move(*(--last));
             std::allocator_traits<Alloc>::destroy(
                 alloc,
-                std::addressof(*(--d_last))
+                std::addressof(*last)
             );
         }
         return d_last;
@@ -388,7 +388,7 @@ namespace aul {
 
             std::allocator_traits<Alloc>::destroy(
                 alloc,
-                std::addressof(*(--d_last))
+                std::addressof(*last)
             );
         }
         return d_last;
@@ -555,10 +555,11 @@ namespace aul {
     }
 
     ///
-    /// Move elements left to initialized memory, destroying the original
-    /// objects that do not overlap with the destination range.
+    /// Move elements left to initialized memory, destroying the objects in
+    /// [a, c) that lie past the end of the destination range.
     ///
-    /// Source and destination range may overlap
+    /// Source and destination range may overlap. [a, c) must hold live
+    /// objects.
     ///
     /// \tparam R_iter Random access iterator
     /// \tparam Alloc Allocator type
@@ -569,10 +570,9 @@ namespace aul {
     /// \return Iterator to end of destination range
     template<class R_iter, class Alloc>
     R_iter destructive_move_elements_left(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
-        auto overlap = std::max((c - b) - (b - a), {});
-        auto it0 = b + overlap;
-        auto it1 = std::move(b, it0, a);
-        return aul::destructive_move(it0, c, it1, alloc);
+        auto it = std::move(b, c, a);
+        aul::destroy(it, c, alloc);
+        return it;
     }
 
     ///
@@ -651,10 +651,11 @@ namespace aul {
     }
 
     ///
-    /// Move elements right to initialized memory, destroying the elements that
-    /// do no overlap with the destination range.
+    /// Move elements right to initialized memory, destroying the objects in
+    /// [a, c) that lie before the beginning of the destination range.
     ///
-    /// Source and destination range may overlap.
+    /// Source and destination range may overlap. [a, c) must hold live
+    /// objects.
     ///
     /// \tparam R_iter Random access iterator type
     /// \tparam Alloc Allocator type
@@ -662,13 +663,12 @@ namespace aul {
     /// \param b Iterator to end of source range
     /// \param c Iterator to end of destination range
     /// \param alloc Allocator to use to destroy elements with
+    /// \return Iterator to beginning of destination range
     template<class R_iter, class Alloc>
     R_iter destructive_move_elements_right(R_iter a, R_iter b, R_iter c, Alloc& alloc) {
-        auto non_overlap = std::min(c - b, b - a);
-
-        auto it0 = std::move_backward(b - non_overlap, b, c);
-        auto it1 = aul::destructive_move_backward(a, b - non_overlap, it0, alloc);
-        return it1;
+        auto it = std::move_backward(a, b, c);
+        aul::destroy(a, it, alloc);
+        return it;
     }
 
     ///
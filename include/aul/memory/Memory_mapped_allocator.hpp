@@ -10,11 +10,34 @@ static_assert(false, "OS not supported");
 #endif
 
 #include <sys/mman.h>
+#include <unistd.h>
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <new>
+#include <numeric>
+#include <type_traits>
 
 namespace aul {
 
+    ///
+    /// A stateless allocator which backs each allocation with an anonymous
+    /// in-memory file which is mapped twice, back to back, into a single
+    /// reserved range of address space. The storage for an allocation of n
+    /// elements is therefore immediately followed by a mirror of itself, so
+    /// that p[i] and p[i + n] refer to the same memory.
+    ///
+    /// Allocations are made in whole pages, so the mirror only begins exactly
+    /// at p + n if n was first rounded with round_size().
+    /// aul::Circular_array does so automatically and uses the mirror to
+    /// present its elements as one contiguous range.
+    ///
+    /// Since each allocation costs several system calls and at least two
+    /// pages of address space, this allocator is only suited to long-lived,
+    /// sizable allocations.
+    ///
+    /// \tparam T Element type
     template<class T>
     class Memory_mapped_allocator {
     public:
@@ -34,39 +57,141 @@ namespace aul {
         using size_type = std::size_t;
         using difference_type = std::ptrdiff_t;
 
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        ///
+        /// Indicates that allocations are followed by a mirror of themselves
+        ///
+        using is_mirrored = std::true_type;
+
+        template<class U>
+        struct rebind {
+            using other = Memory_mapped_allocator<U>;
+        };
+
         //=================================================
         // -ctors
         //=================================================
 
-        Memory_mapped_allocator();
+        Memory_mapped_allocator() noexcept = default;
 
-        ~Memory_mapped_allocator() {
-            if (ptr) {
-                munmap(ptr, allocation_size);
-            }
-        }
+        template<class U>
+        Memory_mapped_allocator(const Memory_mapped_allocator<U>&) noexcept {}
 
         //=================================================
-        // Assignment operators
+        // Comparison operators
         //=================================================
 
+        template<class U>
+        [[nodiscard]]
+        bool operator==(const Memory_mapped_allocator<U>&) const noexcept {
+            return true;
+        }
+
+        template<class U>
+        [[nodiscard]]
+        bool operator!=(const Memory_mapped_allocator<U>&) const noexcept {
+            return false;
+        }
+
         //=================================================
         // Allocation methods
         //=================================================
 
-        //=================================================
-        // Object creation methods
-        //=================================================
+        ///
+        /// \param n Number of elements to allocate storage for
+        /// \return Pointer to storage for round_size(n) elements, followed by
+        ///     a mirror of that storage. Null if n is zero
+        [[nodiscard]]
+        pointer allocate(const size_type n) {
+            if (n == 0) {
+                return nullptr;
+            }
+
+            if (max_size() < n) {
+                throw std::bad_alloc{};
+            }
+
+            const std::size_t bytes = round_size(n) * sizeof(T);
+
+            const int fd = ::memfd_create("aul::Memory_mapped_allocator", MFD_CLOEXEC);
+            if (fd == -1) {
+                throw std::bad_alloc{};
+            }
+
+            if (::ftruncate(fd, static_cast<off_t>(bytes)) == -1) {
+                ::close(fd);
+                throw std::bad_alloc{};
+            }
+
+            //Reserve address space for both views, then map the file over it twice
+            void* region = ::mmap(nullptr, 2 * bytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (region == MAP_FAILED) {
+                ::close(fd);
+                throw std::bad_alloc{};
+            }
+
+            auto* bytes_ptr = static_cast<unsigned char*>(region);
+            const int protection = PROT_READ | PROT_WRITE;
+            const int flags = MAP_SHARED | MAP_FIXED;
+
+            const bool is_mapped =
+                ::mmap(bytes_ptr, bytes, protection, flags, fd, 0) != MAP_FAILED &&
+                ::mmap(bytes_ptr + bytes, bytes, protection, flags, fd, 0) != MAP_FAILED;
+
+            //The mappings keep the file alive
+            ::close(fd);
+
+            if (!is_mapped) {
+                ::munmap(region, 2 * bytes);
+                throw std::bad_alloc{};
+            }
+
+            return static_cast<pointer>(region);
+        }
+
+        ///
+        /// \param p Pointer previously returned by allocate()
+        /// \param n Value previously passed to allocate()
+        void deallocate(const pointer p, const size_type n) noexcept {
+            if (p) {
+                ::munmap(static_cast<void*>(p), 2 * round_size(n) * sizeof(T));
+            }
+        }
 
         //=================================================
-        // Instance members
+        // Accessors
         //=================================================
 
+        ///
+        /// \return Maximum number of elements that can be allocated at once
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            return (std::numeric_limits<size_type>::max() / 2 - page_size()) / sizeof(T);
+        }
+
+        ///
+        /// \param n Number of elements
+        /// \return Smallest number of elements, not less than n, whose storage
+        ///     occupies a whole number of pages
+        [[nodiscard]]
+        static size_type round_size(const size_type n) noexcept {
+            const size_type unit = page_size() / std::gcd(sizeof(T), page_size());
+            return (n + unit - 1) / unit * unit;
+        }
+
     private:
 
-        int file_descriptor = -1;
-        size_type allocation_size = 0;
-        pointer ptr;
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        static size_type page_size() noexcept {
+            static const size_type size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+            return size;
+        }
 
     };
 
@@ -0,0 +1,189 @@
+#ifndef AUL_REMAPPABLE_ALLOCATOR_HPP
+#define AUL_REMAPPABLE_ALLOCATOR_HPP
+
+#ifndef __linux__
+static_assert(false, "OS not supported");
+#endif
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstddef>
+#include <limits>
+#include <new>
+#include <type_traits>
+
+namespace aul {
+
+    ///
+    /// A stateless allocator which backs each allocation with its own
+    /// anonymous memory mapping. In addition to the usual allocator
+    /// interface, it offers reallocate(), which resizes an allocation with
+    /// mremap. The kernel either extends the mapping in place or moves its
+    /// pages to a new address, so the contents are never copied.
+    ///
+    /// reallocate() relocates objects bytewise, so containers should only use
+    /// it for trivially copyable types. aul::Circular_array does so
+    /// automatically when growing.
+    ///
+    /// Allocations are made in whole pages, so this allocator is only suited
+    /// to long-lived, sizable allocations.
+    ///
+    /// \tparam T Element type
+    template<class T>
+    class Remappable_allocator {
+    public:
+
+        //=================================================
+        // Type aliases
+        //=================================================
+
+        using value_type = T;
+
+        using pointer = T*;
+        using const_pointer = const T*;
+
+        using void_pointer = void*;
+        using const_void_pointer = const void*;
+
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+
+        using propagate_on_container_move_assignment = std::true_type;
+        using is_always_equal = std::true_type;
+
+        template<class U>
+        struct rebind {
+            using other = Remappable_allocator<U>;
+        };
+
+        //=================================================
+        // -ctors
+        //=================================================
+
+        Remappable_allocator() noexcept = default;
+
+        template<class U>
+        Remappable_allocator(const Remappable_allocator<U>&) noexcept {}
+
+        //=================================================
+        // Comparison operators
+        //=================================================
+
+        template<class U>
+        [[nodiscard]]
+        bool operator==(const Remappable_allocator<U>&) const noexcept {
+            return true;
+        }
+
+        template<class U>
+        [[nodiscard]]
+        bool operator!=(const Remappable_allocator<U>&) const noexcept {
+            return false;
+        }
+
+        //=================================================
+        // Allocation methods
+        //=================================================
+
+        ///
+        /// \param n Number of elements to allocate storage for
+        /// \return Pointer to storage for n elements. Null if n is zero
+        [[nodiscard]]
+        pointer allocate(const size_type n) {
+            if (n == 0) {
+                return nullptr;
+            }
+
+            if (max_size() < n) {
+                throw std::bad_alloc{};
+            }
+
+            void* region = ::mmap(nullptr, byte_size(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (region == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+
+            return static_cast<pointer>(region);
+        }
+
+        ///
+        /// Resizes an allocation, preserving the bytes of its first
+        /// min(old_n, new_n) elements. The storage may move to a new address.
+        ///
+        /// If an exception is thrown, the original allocation is unaffected.
+        ///
+        /// \param p Pointer previously returned by allocate() or reallocate().
+        ///     May be null if old_n is zero
+        /// \param old_n Value previously passed to allocate() or reallocate()
+        /// \param new_n Number of elements to resize storage to
+        /// \return Pointer to storage for new_n elements. Null if new_n is zero
+        [[nodiscard]]
+        pointer reallocate(const pointer p, const size_type old_n, const size_type new_n) {
+            if (!p) {
+                return allocate(new_n);
+            }
+
+            if (new_n == 0) {
+                deallocate(p, old_n);
+                return nullptr;
+            }
+
+            if (max_size() < new_n) {
+                throw std::bad_alloc{};
+            }
+
+            void* region = ::mremap(static_cast<void*>(p), byte_size(old_n), byte_size(new_n), MREMAP_MAYMOVE);
+            if (region == MAP_FAILED) {
+                throw std::bad_alloc{};
+            }
+
+            return static_cast<pointer>(region);
+        }
+
+        ///
+        /// \param p Pointer previously returned by allocate() or reallocate()
+        /// \param n Value previously passed to allocate() or reallocate()
+        void deallocate(const pointer p, const size_type n) noexcept {
+            if (p) {
+                ::munmap(static_cast<void*>(p), byte_size(n));
+            }
+        }
+
+        //=================================================
+        // Accessors
+        //=================================================
+
+        ///
+        /// \return Maximum number of elements that can be allocated at once
+        [[nodiscard]]
+        size_type max_size() const noexcept {
+            return (std::numeric_limits<size_type>::max() / 2 - page_size()) / sizeof(T);
+        }
+
+    private:
+
+        //=================================================
+        // Helper functions
+        //=================================================
+
+        [[nodiscard]]
+        static size_type page_size() noexcept {
+            static const size_type size = static_cast<size_type>(::sysconf(_SC_PAGESIZE));
+            return size;
+        }
+
+        ///
+        /// \param n Number of elements
+        /// \return Size of mapping used to store n elements, in bytes
+        [[nodiscard]]
+        static size_type byte_size(const size_type n) noexcept {
+            const size_type bytes = n * sizeof(T);
+            return (bytes + page_size() - 1) / page_size() * page_size();
+        }
+
+    };
+
+}
+
+#endif //AUL_REMAPPABLE_ALLOCATOR_HPP
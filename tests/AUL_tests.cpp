@@ -1,13 +1,20 @@
 #include "containers/Array_map_tests.hpp"
-//#include "containers/Circular_array_tests.hpp"
+#include "containers/Chunked_slot_map_tests.hpp"
+#include "containers/Circular_array_tests.hpp"
+#include "containers/Concurrent_slot_map_tests.hpp"
+#include "containers/Spsc_circular_array_tests.hpp"
+#include "containers/Mpmc_circular_array_tests.hpp"
+#include "containers/Sliding_window_tests.hpp"
 //#include "containers/Matrix_tests.hpp"
 //#include "containers/Random_access_iterator_tests.hpp"
-//#include "containers/Slot_map_tests.hpp"
+#include "containers/Slot_map_tests.hpp"
 #include "containers/Zipper_iterator_tests.hpp"
 
 //#include "memory/Memory_tests.hpp"
+#include "memory/Memory_mapped_allocator_tests.hpp"
+#include "memory/Remappable_allocator_tests.hpp"
 
-//#include "Algorithms_tests.hpp"
+#include "Algorithms_tests.hpp"
 //#include "Bit_tests.hpp"
 //#include "Math_tests.hpp"
 //#include "Utility_tests.hpp"
@@ -6,7 +6,10 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstdint>
 #include <numeric>
+#include <random>
+#include <vector>
 
 namespace aul::tests {
 
@@ -104,6 +107,71 @@ namespace aul::tests {
         EXPECT_EQ(vec.begin(), aul::binary_search(vec.begin(), vec.end(), 4));
     }
 
+    template<class T>
+    void test_vectorized_lower_bound() {
+        for (int n = 0; n < 300; n += 7) {
+            std::vector<T> vec;
+            for (int i = 0; i < n; ++i) {
+                //Pairs of equal elements
+                vec.push_back(T(i / 2 * 3));
+            }
+
+            for (int i = -1; i < (n / 2 + 1) * 3; ++i) {
+                const T val = (i < 0) ? std::numeric_limits<T>::lowest() : T(i);
+                const T* expected = std::lower_bound(vec.data(), vec.data() + vec.size(), val);
+                EXPECT_EQ(aul::vectorized_lower_bound(vec.data(), vec.data() + vec.size(), val), expected);
+            }
+        }
+    }
+
+    TEST(aul_vectorized_lower_bound, Arithmetic_types) {
+        test_vectorized_lower_bound<std::int32_t>();
+        test_vectorized_lower_bound<std::uint32_t>();
+        test_vectorized_lower_bound<std::int64_t>();
+        test_vectorized_lower_bound<std::uint64_t>();
+        test_vectorized_lower_bound<std::uint16_t>();
+        test_vectorized_lower_bound<float>();
+        test_vectorized_lower_bound<double>();
+    }
+
+    TEST(aul_vectorized_lower_bound, Unsigned_high_bit) {
+        std::vector<std::uint32_t> vec{1, 2, 0x7FFFFFFF, 0x80000000, 0x80000001, 0xFFFFFFFF};
+
+        for (std::uint32_t x : vec) {
+            EXPECT_EQ(aul::vectorized_lower_bound(vec.data(), vec.data() + vec.size(), x), std::lower_bound(vec.data(), vec.data() + vec.size(), x));
+        }
+    }
+
+    TEST(aul_exponential_search, Matches_lower_bound) {
+        for (int n = 0; n < 100; ++n) {
+            std::vector<int> vec(n);
+            std::iota(vec.begin(), vec.end(), 0);
+
+            for (int i = -1; i <= n; ++i) {
+                EXPECT_EQ(aul::exponential_search(vec.begin(), vec.end(), i), std::lower_bound(vec.begin(), vec.end(), i));
+            }
+        }
+    }
+
+    TEST(aul_parallel_sort, Matches_std_sort) {
+        std::mt19937 gen{42};
+        for (std::size_t n : {0, 1, 1000, 100000, 300001}) {
+            std::vector<std::uint32_t> vec(n);
+            for (auto& x : vec) {
+                x = gen() % 1000;
+            }
+
+            std::vector<std::uint32_t> expected = vec;
+            std::sort(expected.begin(), expected.end());
+
+            for (std::size_t threads : {1, 3, 8}) {
+                std::vector<std::uint32_t> sorted = vec;
+                aul::parallel_sort(sorted.begin(), sorted.end(), std::less<>{}, threads);
+                EXPECT_EQ(sorted, expected);
+            }
+        }
+    }
+
 }
 
 #endif //AUL_TESTS_ALGORITHMS_TESTS_HPP
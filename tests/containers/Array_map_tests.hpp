@@ -5,8 +5,16 @@
 #include <aul/containers/Array_map.hpp>
 
 #include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
 #include <string>
+#include <string_view>
 #include <iostream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
 
 namespace aul::tests {
 
@@ -97,7 +105,7 @@ namespace aul::tests {
         EXPECT_EQ(arr.size(), 0);
 
         EXPECT_EQ(arr.begin(), arr.end());
-        EXPECT_EQ(arr.data(), nullptr);
+        EXPECT_EQ(arr.values().data(), nullptr);
         EXPECT_TRUE(arr.keys().empty());
         EXPECT_TRUE(arr.values().empty());
 
@@ -353,7 +361,7 @@ namespace aul::tests {
         }
 
         for (std::size_t i = 0; i < map.size(); ++i) {
-            results[i] = map.data()[i];
+            results[i] = map.values().data()[i];
         }
 
         map.clear();
@@ -396,6 +404,480 @@ namespace aul::tests {
         EXPECT_EQ(std::get<1>(*map.find(4)), 4.0);
     }
 
+    TEST(Array_map, Insert_range) {
+        aul::Array_map<int, std::string> map;
+        map.insert(10, "ten");
+        map.insert(20, "twenty");
+
+        std::vector<std::pair<int, std::string>> batch{
+            {15, "fifteen"}, {5, "five"}, {20, "duplicate"}, {25, "twenty-five"}, {5, "repeat"}, {0, "zero"}
+        };
+
+        EXPECT_EQ(map.insert(batch), 4);
+        EXPECT_EQ(map.size(), 6);
+        EXPECT_EQ(batch[0].second, "fifteen");
+
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+        EXPECT_EQ(map.at(0), "zero");
+        EXPECT_EQ(map.at(5), "five");
+        EXPECT_EQ(map.at(10), "ten");
+        EXPECT_EQ(map.at(15), "fifteen");
+        EXPECT_EQ(map.at(20), "twenty");
+        EXPECT_EQ(map.at(25), "twenty-five");
+
+        //Merged in place
+        map.reserve(16);
+        std::vector<std::pair<int, std::string>> batch2{{30, "thirty"}, {-5, "minus five"}, {12, "twelve"}};
+        EXPECT_EQ(map.insert(std::move(batch2)), 3);
+        EXPECT_EQ(map.capacity(), 16);
+
+        std::vector<int> expected{-5, 0, 5, 10, 12, 15, 20, 25, 30};
+        EXPECT_TRUE(std::equal(map.keys().begin(), map.keys().end(), expected.begin(), expected.end()));
+        EXPECT_EQ(map.at(-5), "minus five");
+        EXPECT_EQ(map.at(12), "twelve");
+        EXPECT_EQ(map.at(30), "thirty");
+        EXPECT_EQ(map.at(25), "twenty-five");
+    }
+
+    TEST(Array_map, Merge) {
+        aul::Array_map<int, std::string> map0;
+        aul::Array_map<int, std::string> map1;
+
+        for (int i = 0; i < 20; i += 2) {
+            map0.insert(i, std::to_string(i));
+        }
+
+        for (int i = 0; i < 30; i += 3) {
+            map1.insert(i, "map1");
+        }
+
+        EXPECT_EQ(map0.merge(std::move(map1)), 6);
+        EXPECT_TRUE(map1.empty());
+        EXPECT_EQ(map0.size(), 16);
+        EXPECT_TRUE(std::is_sorted(map0.keys().begin(), map0.keys().end()));
+
+        EXPECT_EQ(map0.at(6), "6");
+        EXPECT_EQ(map0.at(9), "map1");
+        EXPECT_EQ(map0.at(27), "map1");
+    }
+
+    TEST(Array_map, Eytzinger_layout) {
+        for (int n = 0; n < 70; ++n) {
+            aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_layout> map;
+
+            std::vector<std::pair<int, int>> pairs;
+            for (int i = 0; i < n; ++i) {
+                pairs.emplace_back(2 * i, i);
+            }
+            map.insert(pairs);
+
+            for (int i = -1; i < 2 * n + 1; ++i) {
+                auto it = map.find(i);
+                if (i >= 0 && i < 2 * n && i % 2 == 0) {
+                    ASSERT_NE(it, map.end());
+                    EXPECT_EQ(std::get<1>(*it), i / 2);
+                    EXPECT_EQ(map.at(i), i / 2);
+                } else {
+                    EXPECT_EQ(it, map.end());
+                    EXPECT_FALSE(map.contains(i));
+                }
+            }
+        }
+
+        aul::Array_map<int, int, std::less<int>, std::allocator<int>, aul::Eytzinger_layout> map;
+        for (int i = 0; i < 40; ++i) {
+            map.emplace((i * 7) % 40, i);
+        }
+
+        map.erase(14);
+        EXPECT_FALSE(map.contains(14));
+        EXPECT_EQ(map.size(), 39);
+
+        for (int i = 0; i < 40; ++i) {
+            if ((i * 7) % 40 != 14) {
+                EXPECT_EQ(map.at((i * 7) % 40), i);
+            }
+        }
+
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+
+        auto copy = map;
+        EXPECT_EQ(copy.at(21), 3);
+        EXPECT_FALSE(copy.contains(14));
+    }
+
+    TEST(Array_map, Find_many) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 100; i += 3) {
+            map.emplace(i, i * 10);
+        }
+
+        std::vector<int> queries{-4, 0, 2, 3, 3, 50, 51, 99, 150};
+        std::vector<decltype(map)::iterator> results;
+        map.find_many(aul::Span<const int>{queries.data(), queries.size()}, std::back_inserter(results));
+
+        ASSERT_EQ(results.size(), queries.size());
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            EXPECT_EQ(results[i], map.find(queries[i]));
+        }
+
+        EXPECT_EQ(std::get<1>(*results[3]), 30);
+        EXPECT_EQ(std::get<1>(*results[7]), 990);
+        EXPECT_EQ(results.back(), map.end());
+    }
+
+    TEST(Array_map, Small_buffer) {
+        aul::Small_array_map<int, std::string, 4> map;
+        EXPECT_EQ(map.capacity(), 0);
+
+        map.emplace(3, "three");
+        map.emplace(1, "one");
+        EXPECT_EQ(map.capacity(), 4);
+
+        const auto* inline_keys = map.key_data();
+        EXPECT_GE(reinterpret_cast<const char*>(inline_keys), reinterpret_cast<const char*>(&map));
+        EXPECT_LT(reinterpret_cast<const char*>(inline_keys), reinterpret_cast<const char*>(&map + 1));
+
+        auto moved = std::move(map);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(moved.at(1), "one");
+        EXPECT_EQ(moved.at(3), "three");
+
+        auto copy = moved;
+        copy.emplace(2, "two");
+
+        swap(copy, moved);
+        EXPECT_EQ(copy.size(), 2);
+        EXPECT_EQ(moved.size(), 3);
+        EXPECT_EQ(moved.at(2), "two");
+
+        //Spill to the heap
+        for (int i = 4; i < 10; ++i) {
+            moved.emplace(i, std::to_string(i));
+        }
+
+        EXPECT_GT(moved.capacity(), 4);
+        EXPECT_EQ(moved.at(1), "one");
+        EXPECT_EQ(moved.at(9), "9");
+
+        copy = std::move(moved);
+        EXPECT_EQ(copy.size(), 9);
+        EXPECT_EQ(copy.at(3), "three");
+
+        swap(copy, moved);
+        EXPECT_EQ(moved.size(), 9);
+        EXPECT_TRUE(copy.empty());
+
+        moved.clear();
+        moved.emplace(0, "zero");
+        EXPECT_EQ(moved.capacity(), 4);
+    }
+
+    struct Counted_key {
+        static inline int constructions = 0;
+
+        explicit Counted_key(int v):
+            value(v) {
+            ++constructions;
+        }
+
+        Counted_key(const Counted_key& k):
+            value(k.value) {
+            ++constructions;
+        }
+
+        Counted_key(Counted_key&&) noexcept = default;
+        Counted_key& operator=(const Counted_key&) = default;
+        Counted_key& operator=(Counted_key&&) noexcept = default;
+
+        int value;
+    };
+
+    struct Counted_key_less {
+        using is_transparent = void;
+
+        bool operator()(const Counted_key& a, const Counted_key& b) const { return a.value < b.value; }
+        bool operator()(const Counted_key& a, int b) const { return a.value < b; }
+        bool operator()(int a, const Counted_key& b) const { return a < b.value; }
+    };
+
+    TEST(Array_map, Heterogeneous_lookup) {
+        aul::Array_map<std::string, int, std::less<>> map;
+        map.emplace(std::string_view{"one"}, 1);
+        map.emplace("two", 2);
+        map.emplace(std::string{"three"}, 3);
+
+        EXPECT_EQ(map.at(std::string_view{"one"}), 1);
+        EXPECT_EQ(map.at("two"), 2);
+        EXPECT_TRUE(map.contains(std::string_view{"three"}));
+        EXPECT_FALSE(map.contains("four"));
+        EXPECT_NE(map.find("one"), map.end());
+
+        int def = -1;
+        EXPECT_EQ(map.get_or_default("four", def), -1);
+        EXPECT_EQ(map.get_or_default(std::string_view{"two"}, def), 2);
+
+        map.erase(std::string_view{"two"});
+        EXPECT_FALSE(map.contains("two"));
+        EXPECT_EQ(map.size(), 2);
+        EXPECT_THROW((void)map.at("two"), std::out_of_range);
+    }
+
+    TEST(Array_map, Heterogeneous_lookup_defers_key_construction) {
+        aul::Array_map<Counted_key, int, Counted_key_less> map;
+        map.reserve(8);
+
+        map.emplace(5, 50);
+        map.emplace(1, 10);
+        EXPECT_EQ(Counted_key::constructions, 2);
+
+        EXPECT_FALSE(map.emplace(5, 0).second);
+        EXPECT_EQ(map.at(5), 50);
+        EXPECT_TRUE(map.contains(1));
+        EXPECT_FALSE(map.contains(2));
+        EXPECT_EQ(map.find(2), map.end());
+        map.erase(1);
+
+        EXPECT_EQ(Counted_key::constructions, 2);
+        EXPECT_EQ(map.size(), 1);
+    }
+
+    TEST(Array_map, Emplace_buffered) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 100; ++i) {
+            map.emplace(2 * i, i);
+        }
+
+        //Out of order arrivals near the back
+        EXPECT_TRUE(map.emplace_buffered(201, 1).second);
+        EXPECT_TRUE(map.emplace_buffered(199, 2).second);
+        EXPECT_TRUE(map.emplace_buffered(7, 3).second);
+        EXPECT_FALSE(map.emplace_buffered(40, 0).second);
+        EXPECT_FALSE(map.emplace_buffered(199, 0).second);
+        EXPECT_EQ(map.buffered(), 3);
+        EXPECT_EQ(map.size(), 103);
+
+        EXPECT_EQ(map.at(199), 2);
+        EXPECT_EQ(map.at(40), 20);
+        EXPECT_TRUE(map.contains(7));
+        EXPECT_FALSE(map.contains(9));
+        EXPECT_EQ(map.find(9), map.end());
+
+        std::vector<int> queries{0, 7, 9, 198, 199, 201, 202};
+        std::vector<decltype(map)::iterator> results;
+        map.find_many(aul::Span<const int>{queries.data(), queries.size()}, std::back_inserter(results));
+        for (std::size_t i = 0; i < queries.size(); ++i) {
+            EXPECT_EQ(results[i], map.find(queries[i]));
+        }
+
+        aul::Array_map<int, int> copy = map;
+        EXPECT_EQ(copy.buffered(), 3);
+        copy.flush();
+        EXPECT_TRUE(copy == map);
+
+        map.erase(199);
+        EXPECT_EQ(map.buffered(), 2);
+        EXPECT_FALSE(copy == map);
+
+        map.flush();
+        EXPECT_EQ(map.buffered(), 0);
+        EXPECT_EQ(map.size(), 102);
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+        EXPECT_EQ(map.at(7), 3);
+        EXPECT_EQ(map.at(201), 1);
+    }
+
+    TEST(Array_map, Const_slices_with_buffered_elements) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 100; ++i) {
+            map.emplace(2 * i, i);
+        }
+
+        map.emplace_buffered(7, -7);
+        map.emplace_buffered(201, -201);
+
+        const auto& const_map = map;
+        ASSERT_EQ(const_map.buffered(), 2);
+
+        //One slice per sorted run
+        auto [main_7, buffered_7] = const_map.equal_range_runs(7);
+        EXPECT_TRUE(main_7.empty());
+        ASSERT_EQ(buffered_7.size(), 1);
+        EXPECT_EQ(std::get<1>(buffered_7[0]), -7);
+
+        auto [main_40, buffered_40] = const_map.equal_range_runs(40);
+        ASSERT_EQ(main_40.size(), 1);
+        EXPECT_EQ(std::get<1>(main_40[0]), 20);
+        EXPECT_TRUE(buffered_40.empty());
+
+        auto [main_9, buffered_9] = const_map.equal_range_runs(9);
+        EXPECT_TRUE(main_9.empty());
+        EXPECT_TRUE(buffered_9.empty());
+
+        auto [main_window, buffered_window] = const_map.range_runs(10, 16);
+        ASSERT_EQ(main_window.size(), 3);
+        EXPECT_EQ(std::get<1>(main_window[0]), 5);
+        EXPECT_EQ(std::get<1>(main_window[2]), 7);
+        EXPECT_TRUE(buffered_window.empty());
+
+        auto [main_tail, buffered_tail] = const_map.upper_bound_runs(198);
+        EXPECT_TRUE(main_tail.empty());
+        ASSERT_EQ(buffered_tail.size(), 1);
+        EXPECT_EQ(std::get<1>(buffered_tail[0]), -201);
+
+        //Slices which include elements from both runs
+        auto [main_head, buffered_head] = const_map.range_runs(0, 10);
+        EXPECT_EQ(main_head.size(), 5);
+        ASSERT_EQ(buffered_head.size(), 1);
+        EXPECT_EQ(std::get<0>(buffered_head[0]), 7);
+
+        auto [main_upper, buffered_upper] = const_map.lower_bound_runs(100);
+        EXPECT_EQ(main_upper.size(), 50);
+        ASSERT_EQ(buffered_upper.size(), 1);
+        EXPECT_EQ(std::get<0>(buffered_upper[0]), 201);
+
+        //The non-const queries flush instead
+        EXPECT_EQ(map.range(0, 10).size(), 6);
+        EXPECT_EQ(map.buffered(), 0);
+        EXPECT_EQ(const_map.lower_bound_runs(100).first.size(), 51);
+        EXPECT_TRUE(const_map.lower_bound_runs(100).second.empty());
+    }
+
+    TEST(Array_map, Emplace_buffered_flushes_at_limit) {
+        aul::Array_map<int, int> map;
+        for (int i = 0; i < 1000; ++i) {
+            map.emplace_buffered(i % 2 ? 1000 - i : i, i);
+            EXPECT_LE(map.buffered(), map.buffer_limit());
+        }
+
+        EXPECT_EQ(map.size(), 1000);
+        map.emplace(5000, 0);
+        EXPECT_EQ(map.buffered(), 0);
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(map.at(i % 2 ? 1000 - i : i), i);
+        }
+    }
+
+    TEST(Array_map, Range_queries) {
+        aul::Array_map<long, int> map;
+        for (int i = 0; i < 50; ++i) {
+            map.emplace(10 * i, i);
+        }
+        map.emplace_buffered(15, 100);
+
+        auto window = map.range(100, 150);
+        EXPECT_EQ(map.buffered(), 0);
+        ASSERT_EQ(window.size(), 5);
+        EXPECT_EQ(std::get<0>(window.front()), 100);
+        EXPECT_EQ(std::get<0>(window.back()), 140);
+
+        int sum = 0;
+        for (auto [key, value] : window) {
+            sum += value;
+            value = 0;
+        }
+        EXPECT_EQ(sum, 10 + 11 + 12 + 13 + 14);
+        EXPECT_EQ(map.at(120), 0);
+
+        EXPECT_EQ(map.lower_bound(15).size(), 49);
+        EXPECT_EQ(map.upper_bound(15).size(), 48);
+        EXPECT_EQ(map.lower_bound(16).size(), 48);
+        EXPECT_EQ(map.upper_bound(490).size(), 0);
+        EXPECT_EQ(map.equal_range(15).size(), 1);
+        EXPECT_EQ(std::get<1>(map.equal_range(15).front()), 100);
+        EXPECT_EQ(map.equal_range(16).size(), 0);
+        EXPECT_EQ(map.range(150, 100).size(), 0);
+
+        const auto& const_map = map;
+        auto const_window = const_map.range_runs(-5, 25).first;
+        ASSERT_EQ(const_window.size(), 4);
+        EXPECT_EQ(std::get<1>(const_window[2]), 100);
+
+        aul::Array_map<long, int> empty;
+        EXPECT_TRUE(empty.range(0, 10).empty());
+        EXPECT_TRUE(empty.lower_bound(0).empty());
+    }
+
+    TEST(Array_map, Parallel_construction) {
+        std::vector<std::pair<std::string, int>> pairs;
+        for (int i = 0; i < 100000; ++i) {
+            pairs.emplace_back(std::to_string(i), i);
+        }
+        std::shuffle(pairs.begin(), pairs.end(), std::mt19937{7});
+
+        aul::Array_map<std::string, int> map{aul::Parallel_execution{4}, pairs.begin(), pairs.end()};
+        ASSERT_EQ(map.size(), pairs.size());
+        EXPECT_TRUE(std::is_sorted(map.keys().begin(), map.keys().end()));
+        for (const auto& pair : pairs) {
+            EXPECT_EQ(map.at(pair.first), pair.second);
+        }
+
+        pairs.push_back(pairs[500]);
+        auto construct_with_duplicate = [&] () {
+            aul::Array_map<std::string, int> dup{aul::Parallel_execution{4}, pairs.begin(), pairs.end()};
+        };
+        EXPECT_THROW(construct_with_duplicate(), std::runtime_error);
+
+        std::vector<std::pair<int, int>> none;
+        aul::Array_map<int, int> empty{aul::Parallel_execution{}, none.begin(), none.end()};
+        EXPECT_TRUE(empty.empty());
+    }
+
+    struct Throwing_move {
+        static inline std::atomic<int> live_count{0};
+        static inline std::atomic<int> moves_left{0};
+
+        Throwing_move(int v): v(v) {
+            ++live_count;
+        }
+
+        Throwing_move(const Throwing_move& other): v(other.v) {
+            ++live_count;
+        }
+
+        Throwing_move(Throwing_move&& other): v(other.v) {
+            if (--moves_left == 0) {
+                throw std::runtime_error("Throwing_move");
+            }
+            ++live_count;
+        }
+
+        ~Throwing_move() {
+            --live_count;
+        }
+
+        int v;
+    };
+
+    TEST(Array_map, Parallel_construction_throwing_move) {
+        {
+            std::vector<int> keys(100000);
+            std::iota(keys.begin(), keys.end(), 0);
+            std::shuffle(keys.begin(), keys.end(), std::mt19937{7});
+
+            std::vector<std::pair<int, Throwing_move>> pairs;
+            pairs.reserve(keys.size());
+            for (int key : keys) {
+                pairs.emplace_back(key, Throwing_move{key});
+            }
+
+            const int live_count = Throwing_move::live_count;
+            Throwing_move::moves_left = 70000;
+
+            auto construct = [&] () {
+                aul::Array_map<int, Throwing_move> map{aul::Parallel_execution{4}, pairs.begin(), pairs.end()};
+            };
+            EXPECT_THROW(construct(), std::runtime_error);
+
+            //Elements constructed by every chunk were destroyed
+            EXPECT_EQ(Throwing_move::live_count, live_count);
+        }
+
+        EXPECT_EQ(Throwing_move::live_count, 0);
+    }
+
 }
 
 #endif //AUL_ARRAY_MAP_TESTS_HPP
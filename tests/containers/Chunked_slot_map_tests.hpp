@@ -0,0 +1,186 @@
+#ifndef AUL_CHUNKED_SLOT_MAP_TESTS_HPP
+#define AUL_CHUNKED_SLOT_MAP_TESTS_HPP
+
+#include <aul/containers/Chunked_slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Chunked_slot_map, Default_constructor) {
+        aul::Chunked_slot_map<double> map;
+
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(map.capacity(), 0);
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.begin(), map.end());
+        EXPECT_FALSE(map.contains({}));
+    }
+
+    TEST(Chunked_slot_map, Copy_constructor) {
+        aul::Chunked_slot_map<std::string, 4> map0;
+        std::vector<decltype(map0)::key_type> keys;
+
+        for (int i = 0; i < 10; ++i) {
+            keys.push_back(map0.emplace(std::to_string(i)));
+        }
+        map0.erase(keys[3]);
+
+        aul::Chunked_slot_map<std::string, 4> map1{map0};
+
+        EXPECT_EQ(map0, map1);
+        EXPECT_FALSE(map1.contains(keys[3]));
+        for (int i = 0; i < 10; ++i) {
+            if (i != 3) {
+                EXPECT_EQ(map1.at(keys[i]), std::to_string(i));
+            }
+        }
+    }
+
+    TEST(Chunked_slot_map, Move_constructor) {
+        aul::Chunked_slot_map<int, 4> map0;
+        auto key = map0.emplace(7);
+
+        aul::Chunked_slot_map<int, 4> map1{std::move(map0)};
+
+        EXPECT_TRUE(map0.empty());
+        EXPECT_EQ(map0.capacity(), 0);
+        EXPECT_EQ(map1.at(key), 7);
+    }
+
+    //=====================================================
+    // Mutator tests
+    //=====================================================
+
+    TEST(Chunked_slot_map, Emplace) {
+        aul::Chunked_slot_map<int32_t, 8> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int32_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        EXPECT_EQ(map.size(), 100);
+        EXPECT_EQ(map.capacity(), 104);
+
+        for (int32_t i = 0; i < 100; ++i) {
+            EXPECT_EQ(map.begin()[i], i);
+            EXPECT_EQ(map[keys[i]], i);
+        }
+
+        int32_t expected = 0;
+        for (auto x : map) {
+            EXPECT_EQ(x, expected++);
+        }
+        EXPECT_EQ(expected, 100);
+    }
+
+    TEST(Chunked_slot_map, Growth_does_not_move_elements) {
+        aul::Chunked_slot_map<std::string, 4> map;
+
+        auto key = map.emplace("stable");
+        const std::string* ptr = &map[key];
+
+        for (int i = 0; i < 256; ++i) {
+            map.emplace(std::to_string(i));
+        }
+
+        map.reserve(4096);
+
+        EXPECT_EQ(&map[key], ptr);
+        EXPECT_EQ(*ptr, "stable");
+    }
+
+    TEST(Chunked_slot_map, Erase_key) {
+        aul::Chunked_slot_map<int, 4> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 9; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        EXPECT_TRUE(map.erase(keys[1]));
+        EXPECT_FALSE(map.erase(keys[1]));
+        EXPECT_TRUE(map.erase(keys[8]));
+        EXPECT_TRUE(map.erase(keys[0]));
+
+        EXPECT_EQ(map.size(), 6);
+        EXPECT_ANY_THROW(static_cast<void>(map.at(keys[0])));
+
+        for (int i : {2, 3, 4, 5, 6, 7}) {
+            EXPECT_EQ(map.at(keys[i]), i);
+        }
+
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+
+        auto key = map.emplace(100);
+        EXPECT_EQ(map.at(key), 100);
+        EXPECT_FALSE(map.contains(keys[0]));
+        EXPECT_FALSE(map.contains(keys[1]));
+        EXPECT_FALSE(map.contains(keys[8]));
+    }
+
+    TEST(Chunked_slot_map, Erase_iterator) {
+        aul::Chunked_slot_map<int, 2> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 4; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        map.erase(map.begin());
+
+        EXPECT_EQ(map.size(), 3);
+        EXPECT_EQ(map.begin()[0], 3);
+        EXPECT_EQ(map.begin()[1], 1);
+        EXPECT_EQ(map.begin()[2], 2);
+        EXPECT_FALSE(map.contains(keys[0]));
+    }
+
+    TEST(Chunked_slot_map, Iterators) {
+        aul::Chunked_slot_map<int, 4> map;
+        for (int i = 0; i < 11; ++i) {
+            map.emplace(i);
+        }
+
+        std::vector<int> reversed(map.begin(), map.end());
+        std::reverse(reversed.begin(), reversed.end());
+
+        std::vector<int> walked;
+        for (auto it = map.end(); it != map.begin();) {
+            --it;
+            walked.push_back(*it);
+        }
+
+        EXPECT_EQ(walked, reversed);
+        EXPECT_EQ(map.end() - map.begin(), 11);
+        EXPECT_EQ(*(map.begin() + 9), 9);
+        EXPECT_EQ(*(map.end() - 5), 6);
+    }
+
+    TEST(Chunked_slot_map, Clear) {
+        aul::Chunked_slot_map<std::string> map;
+        for (int i = 0; i < 100; ++i) {
+            map.emplace(std::to_string(i));
+        }
+
+        map.clear();
+
+        EXPECT_TRUE(map.empty());
+        EXPECT_EQ(map.capacity(), 0);
+        EXPECT_EQ(map.begin(), map.end());
+    }
+
+}
+
+#endif //AUL_CHUNKED_SLOT_MAP_TESTS_HPP
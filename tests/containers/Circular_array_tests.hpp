@@ -8,8 +8,15 @@
 #include <aul/containers/Circular_array.hpp>
 
 #include <iostream>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 
+#if defined(__linux__)
+#include <aul/memory/Memory_mapped_allocator.hpp>
+#include <aul/memory/Remappable_allocator.hpp>
+#endif
+
 namespace aul::tests {
 
     //=====================================================
@@ -295,6 +302,56 @@ namespace aul::tests {
         }
     }
 
+    TEST(Circular_array, Emplace_near_front) {
+        for (int i = 1; i < 4; ++i) {
+            aul::Circular_array<std::string> arr{};
+            arr.reserve(16);
+
+            std::vector<std::string> expected{};
+            for (int j = 0; j < 8; ++j) {
+                arr.push_back(std::to_string(j));
+                expected.push_back(std::to_string(j));
+            }
+
+            auto it = arr.emplace(arr.begin() + i, "x");
+            expected.insert(expected.begin() + i, "x");
+
+            EXPECT_EQ(it - arr.begin(), i);
+            EXPECT_EQ(*it, "x");
+            ASSERT_EQ(arr.size(), expected.size());
+            EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+            it = arr.insert(arr.begin() + i, 2, std::string{"y"});
+            expected.insert(expected.begin() + i, 2, "y");
+
+            EXPECT_EQ(it - arr.begin(), i);
+            ASSERT_EQ(arr.size(), expected.size());
+            EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+        }
+    }
+
+    TEST(Circular_array, Emplace_at_end_of_allocation) {
+        aul::Circular_array<std::string> arr{};
+        arr.reserve(8);
+
+        //Leave the elements in the last four slots of the allocation
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(std::to_string(i));
+        }
+        for (int i = 0; i < 4; ++i) {
+            arr.pop_front();
+        }
+
+        arr.emplace(arr.begin() + 3, "x");
+
+        EXPECT_EQ(arr.capacity(), 8);
+        ASSERT_EQ(arr.size(), 5);
+        const char* expected[] = {"4", "5", "6", "x", "7"};
+        for (int i = 0; i < 5; ++i) {
+            EXPECT_EQ(arr[i], expected[i]);
+        }
+    }
+
     TEST(Circular_array, Insert_n_single) {
         Circular_array<float> arr{};
         arr.insert(arr.begin(), 1, 5.0f);
@@ -323,6 +380,120 @@ namespace aul::tests {
         }
     }
 
+    TEST(Circular_array, Range_insert_into_wrapped_array) {
+        for (int i = 0; i <= 6; ++i) {
+            aul::Circular_array<std::string> arr{};
+            arr.reserve(12);
+
+            //Wrap the elements around the end of the allocation
+            for (int j = 0; j < 3; ++j) {
+                arr.push_front(std::to_string(2 - j));
+            }
+            for (int j = 3; j < 6; ++j) {
+                arr.push_back(std::to_string(j));
+            }
+
+            std::vector<std::string> expected(arr.begin(), arr.end());
+            std::vector<std::string> src{"a", "b", "c", "d"};
+
+            auto it = arr.insert(arr.begin() + i, src.begin(), src.end());
+            expected.insert(expected.begin() + i, src.begin(), src.end());
+
+            EXPECT_EQ(it - arr.begin(), i);
+            EXPECT_EQ(arr.capacity(), 12);
+            ASSERT_EQ(arr.size(), expected.size());
+            EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+            //Insertion which forces a new allocation
+            std::vector<std::string> big(10, "z");
+            it = arr.insert(arr.begin() + i, big.begin(), big.end());
+            expected.insert(expected.begin() + i, big.begin(), big.end());
+
+            EXPECT_EQ(it - arr.begin(), i);
+            ASSERT_EQ(arr.size(), expected.size());
+            EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+        }
+    }
+
+    TEST(Circular_array, Insert_n_zero) {
+        aul::Circular_array<std::string> arr{};
+        for (int i = 0; i < 8; ++i) {
+            arr.push_back(std::string(24, 'a' + i));
+        }
+        std::vector<std::string> expected(arr.begin(), arr.end());
+
+        auto it = arr.insert(arr.begin() + 3, 0, std::string(24, 'z'));
+
+        EXPECT_EQ(it - arr.begin(), 3);
+        ASSERT_EQ(arr.size(), expected.size());
+        EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+    }
+
+    TEST(Circular_array, Insert_n_across_allocation_end) {
+        for (int head = 0; head < 8; ++head) {
+            for (int i = 0; i <= 4; ++i) {
+                aul::Circular_array<std::string> arr{};
+                arr.reserve(12);
+
+                //Place the head at the given slot of the allocation
+                for (int j = 0; j < head; ++j) {
+                    arr.push_back("");
+                }
+                for (int j = 0; j < 4; ++j) {
+                    arr.push_back(std::string(24, 'a' + j));
+                }
+                for (int j = 0; j < head; ++j) {
+                    arr.pop_front();
+                }
+
+                std::vector<std::string> expected(arr.begin(), arr.end());
+
+                auto it = arr.insert(arr.begin() + i, 3, std::string(24, 'x'));
+                expected.insert(expected.begin() + i, 3, std::string(24, 'x'));
+
+                EXPECT_EQ(it - arr.begin(), i);
+                EXPECT_EQ(arr.capacity(), 12);
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+                it = arr.emplace(arr.begin() + i, 24, 'y');
+                expected.emplace(expected.begin() + i, 24, 'y');
+
+                EXPECT_EQ(it - arr.begin(), i);
+                EXPECT_EQ(arr.capacity(), 12);
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+            }
+        }
+    }
+
+    TEST(Circular_array, Insert_n_with_growth) {
+        for (int i = 0; i <= 6; ++i) {
+            aul::Circular_array<std::string> arr{};
+            arr.reserve(6);
+
+            //Wrap the elements around the end of the allocation
+            for (int j = 0; j < 3; ++j) {
+                arr.push_front(std::string(24, '2' - j));
+            }
+            for (int j = 3; j < 6; ++j) {
+                arr.push_back(std::string(24, '0' + j));
+            }
+
+            std::vector<std::string> expected(arr.begin(), arr.end());
+
+            for (int n = 1; n < 40; n *= 3) {
+                auto it = arr.insert(arr.begin() + i, n, std::string(24, 'a' + n % 26));
+                expected.insert(expected.begin() + i, n, std::string(24, 'a' + n % 26));
+
+                EXPECT_EQ(it - arr.begin(), i);
+                EXPECT_GE(arr.capacity(), arr.size());
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+            }
+        }
+    }
+
     //=====================================================
     // Element removal
     //=====================================================
@@ -404,6 +575,77 @@ namespace aul::tests {
         EXPECT_ANY_THROW(arr.at(7));
     }
 
+    TEST(Circular_array, Erase_range_from_wrapped_array) {
+        for (int wrap = 1; wrap < 8; ++wrap) {
+            aul::Circular_array<int> arr{};
+            arr.reserve(8);
+
+            //Place the head wrap slots before the end of the allocation
+            for (int i = 0; i < 8 - wrap; ++i) {
+                arr.push_back(-1);
+            }
+            arr.push_back(0);
+            for (int i = 0; i < 8 - wrap; ++i) {
+                arr.pop_front();
+            }
+            for (int i = 1; i < 7; ++i) {
+                arr.push_back(i);
+            }
+
+            //Erasing near the front moves the head forward
+            arr.erase(arr.begin() + 1, arr.begin() + 3);
+
+            EXPECT_EQ(arr.capacity(), 8);
+            ASSERT_EQ(arr.size(), 5);
+            const int expected[] = {0, 3, 4, 5, 6};
+            for (int i = 0; i < 5; ++i) {
+                EXPECT_EQ(arr[i], expected[i]);
+            }
+        }
+    }
+
+    TEST(Circular_array, Erase_strings) {
+        for (int i = 0; i < 10; ++i) {
+            aul::Circular_array<std::string> arr{};
+            std::vector<std::string> expected;
+            for (int j = 0; j < 10; ++j) {
+                arr.push_back(std::string(24, 'a' + j));
+                expected.push_back(std::string(24, 'a' + j));
+            }
+
+            arr.erase(arr.begin() + i);
+            expected.erase(expected.begin() + i);
+
+            ASSERT_EQ(arr.size(), expected.size());
+            EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+        }
+    }
+
+    TEST(Circular_array, Erase_range_strings) {
+        for (int from = 0; from <= 10; ++from) {
+            for (int to = from; to <= 10; ++to) {
+                aul::Circular_array<std::string> arr{};
+                std::vector<std::string> expected;
+                for (int j = 0; j < 10; ++j) {
+                    arr.push_back(std::string(24, 'a' + j));
+                    expected.push_back(std::string(24, 'a' + j));
+                }
+
+                arr.erase(arr.begin() + from, arr.begin() + to);
+                expected.erase(expected.begin() + from, expected.begin() + to);
+
+                ASSERT_EQ(arr.size(), expected.size());
+                EXPECT_TRUE(std::equal(arr.begin(), arr.end(), expected.begin()));
+
+                //Elements remain usable after the erasure
+                arr.push_front("front");
+                arr.push_back("back");
+                EXPECT_EQ(arr.front(), "front");
+                EXPECT_EQ(arr.back(), "back");
+            }
+        }
+    }
+
     //=====================================================
     // Misc. functions
     //=====================================================
@@ -438,6 +680,282 @@ namespace aul::tests {
         EXPECT_ANY_THROW(arr.at(2));
     }
 
+    //=====================================================
+    // Capacity policies
+    //=====================================================
+
+    TEST(Circular_array, Power_of_two_capacity) {
+        aul::Circular_array<int, std::allocator<int>, aul::Power_of_two_capacity> arr{};
+        EXPECT_EQ(arr.capacity(), 0);
+
+        arr.reserve(5);
+        EXPECT_EQ(arr.capacity(), 8);
+
+        aul::Circular_array<int, std::allocator<int>, aul::Power_of_two_capacity> list_arr{1, 2, 3};
+        EXPECT_EQ(list_arr.capacity(), 4);
+
+        for (int i = 0; i < 9; ++i) {
+            list_arr.push_back(4 + i);
+            EXPECT_EQ(list_arr.capacity() & (list_arr.capacity() - 1), 0);
+        }
+        EXPECT_EQ(list_arr.capacity(), 16);
+    }
+
+    TEST(Circular_array, Power_of_two_capacity_wrap_around) {
+        aul::Circular_array<int, std::allocator<int>, aul::Power_of_two_capacity> arr{};
+        arr.reserve(8);
+
+        //Move the head around the allocation several times
+        for (int i = 0; i < 20; ++i) {
+            arr.push_back(i);
+            if (arr.size() > 6) {
+                arr.pop_front();
+            }
+        }
+        arr.push_front(13);
+        EXPECT_EQ(arr.capacity(), 8);
+
+        const int expected[] = {13, 14, 15, 16, 17, 18, 19};
+        ASSERT_EQ(arr.size(), 7);
+        ASSERT_EQ(arr.end() - arr.begin(), 7);
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(arr[i], expected[i]);
+            EXPECT_EQ(arr.begin()[i], expected[i]);
+            EXPECT_EQ(*(arr.end() - 7 + i), expected[i]);
+        }
+        EXPECT_EQ(arr.front(), 13);
+        EXPECT_EQ(arr.back(), 19);
+
+        int i = 0;
+        for (int x : arr) {
+            EXPECT_EQ(x, expected[i++]);
+        }
+
+        arr.pop_back();
+        arr.emplace(arr.begin() + 3, 100);
+        const int expected_after_emplace[] = {13, 14, 15, 100, 16, 17, 18};
+        for (std::size_t j = 0; j < arr.size(); ++j) {
+            EXPECT_EQ(arr[j], expected_after_emplace[j]);
+        }
+    }
+
+    //=====================================================
+    // Bounded mode
+    //=====================================================
+
+    TEST(Circular_array, Bounded_push_back_overwrites_oldest) {
+        aul::Circular_array<std::string> arr{};
+        arr.reserve(4);
+        arr.set_bounded(true);
+        EXPECT_TRUE(arr.is_bounded());
+
+        for (int i = 0; i < 10; ++i) {
+            arr.push_back(std::to_string(i));
+        }
+
+        EXPECT_EQ(arr.capacity(), 4);
+        ASSERT_EQ(arr.size(), 4);
+        const char* expected[] = {"6", "7", "8", "9"};
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(arr[i], expected[i]);
+        }
+
+        arr.push_front("5");
+        EXPECT_EQ(arr.front(), "5");
+        EXPECT_EQ(arr.back(), "8");
+        EXPECT_EQ(arr.capacity(), 4);
+
+        EXPECT_THROW(arr.insert(arr.begin() + 1, std::string{"x"}), std::length_error);
+        EXPECT_THROW(arr.insert(arr.begin(), 2, std::string{"x"}), std::length_error);
+
+        auto copy = arr;
+        EXPECT_TRUE(copy.is_bounded());
+        EXPECT_EQ(copy.capacity(), 4);
+
+        //Insertions which exactly fill the allocation don't reallocate
+        aul::Circular_array<std::string> partial{};
+        partial.reserve(4);
+        partial.set_bounded(true);
+        partial.push_back("a");
+        partial.push_back("d");
+        partial.insert(partial.begin() + 1, 2, std::string{"x"});
+        EXPECT_EQ(partial.capacity(), 4);
+        ASSERT_EQ(partial.size(), 4);
+        EXPECT_EQ(partial.front(), "a");
+        EXPECT_EQ(partial[1], "x");
+        EXPECT_EQ(partial[2], "x");
+        EXPECT_EQ(partial.back(), "d");
+
+        aul::Circular_array<int> empty{};
+        empty.set_bounded(true);
+        EXPECT_THROW(empty.push_back(1), std::length_error);
+    }
+
+    TEST(Circular_array, Segments_and_linearize) {
+        for (int wrap = 1; wrap < 7; ++wrap) {
+            aul::Circular_array<std::string> arr{};
+            arr.reserve(8);
+            arr.set_bounded(true);
+
+            //Leave a gap of one slot with wrap elements in the second segment
+            for (int i = 0; i < 8 + wrap; ++i) {
+                arr.push_back(std::to_string(i));
+            }
+            arr.pop_front();
+
+            auto segment0 = arr.first_segment();
+            auto segment1 = arr.second_segment();
+            EXPECT_EQ(segment0.size() + segment1.size(), 7);
+            EXPECT_EQ(segment1.size(), static_cast<std::size_t>(wrap));
+            EXPECT_EQ(segment0[0], arr.front());
+            EXPECT_EQ(segment1[segment1.size() - 1], arr.back());
+
+            arr.linearize();
+
+            EXPECT_EQ(arr.capacity(), 8);
+            EXPECT_EQ(arr.second_segment().size(), 0);
+            ASSERT_EQ(arr.first_segment().size(), 7);
+            for (std::size_t i = 0; i < arr.size(); ++i) {
+                EXPECT_EQ(arr.data()[i], std::to_string(wrap + 1 + i));
+                EXPECT_EQ(arr[i], std::to_string(wrap + 1 + i));
+            }
+
+            arr.push_back("end");
+            EXPECT_EQ(arr.back(), "end");
+            EXPECT_EQ(arr.size(), 8);
+        }
+    }
+
+    TEST(Circular_array, Segment_aware_algorithms) {
+        aul::Circular_array<int> arr{};
+        arr.reserve(8);
+        arr.set_bounded(true);
+
+        //Elements 3 through 10, wrapped three slots around the allocation
+        for (int i = 0; i < 11; ++i) {
+            arr.push_back(i);
+        }
+
+        std::size_t segment_count = 0;
+        std::size_t element_count = 0;
+        aul::for_each_segment(arr.begin(), arr.end(), [&] (const int* p0, const int* p1) {
+            ++segment_count;
+            element_count += (p1 - p0);
+        });
+        EXPECT_EQ(segment_count, 2);
+        EXPECT_EQ(element_count, 8);
+
+        EXPECT_EQ(aul::reduce(arr.begin(), arr.end(), 0), 52);
+        EXPECT_EQ(aul::reduce(arr.begin() + 4, arr.end(), 1, std::multiplies<>{}), 7 * 8 * 9 * 10);
+
+        std::vector<int> vec(8);
+        EXPECT_EQ(aul::copy(arr.begin(), arr.end(), vec.begin()), vec.end());
+        EXPECT_EQ(vec, (std::vector<int>{3, 4, 5, 6, 7, 8, 9, 10}));
+
+        std::vector<int> src{10, 20, 30, 40, 50, 60, 70, 80};
+        EXPECT_EQ(aul::copy(src.begin(), src.end(), arr.begin()), arr.end());
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(arr[i], src[i]);
+        }
+
+        auto square = [] (int x) { return x * x; };
+        aul::transform(arr.begin(), arr.end(), arr.begin(), square);
+        for (int i = 0; i < 8; ++i) {
+            EXPECT_EQ(arr[i], square(src[i]));
+        }
+
+        aul::fill(arr.begin() + 2, arr.end() - 1, -1);
+        EXPECT_EQ(arr[1], 400);
+        EXPECT_EQ(arr[2], -1);
+        EXPECT_EQ(arr[6], -1);
+        EXPECT_EQ(arr[7], 6400);
+
+        //Copying between two wrapped arrays
+        aul::Circular_array<int, std::allocator<int>, aul::Power_of_two_capacity> other{};
+        other.reserve(8);
+        other.set_bounded(true);
+        for (int i = 0; i < 13; ++i) {
+            other.push_back(0);
+        }
+        aul::copy(arr.begin(), arr.end(), other.begin());
+        EXPECT_TRUE(std::equal(arr.begin(), arr.end(), other.begin(), other.end()));
+    }
+
+    #if defined(__linux__)
+
+    TEST(Circular_array, Mirrored_allocator_is_contiguous) {
+        using allocator_type = aul::Memory_mapped_allocator<int>;
+        aul::Circular_array<int, allocator_type> arr{};
+
+        arr.reserve(100);
+        EXPECT_EQ(arr.capacity(), allocator_type::round_size(100));
+        arr.set_bounded(true);
+
+        const int n = static_cast<int>(arr.capacity());
+        for (int i = 0; i < n + n / 2; ++i) {
+            arr.push_back(i);
+        }
+
+        //Elements wrap around the end of the allocation, but are presented
+        //as a single range through the mirror
+        ASSERT_EQ(arr.size(), arr.capacity());
+        EXPECT_EQ(arr.second_segment().size(), 0);
+        ASSERT_EQ(arr.first_segment().size(), arr.size());
+
+        const int* p = arr.data();
+        for (int i = 0; i < n; ++i) {
+            EXPECT_EQ(p[i], n / 2 + i);
+            EXPECT_EQ(arr[i], n / 2 + i);
+        }
+
+        arr.linearize();
+        EXPECT_EQ(arr.data(), p);
+
+        aul::Circular_array<int, allocator_type, aul::Power_of_two_capacity> pow2_arr{};
+        pow2_arr.reserve(5000);
+        EXPECT_EQ(pow2_arr.capacity(), 8192);
+    }
+
+    TEST(Circular_array, Reallocating_allocator_growth) {
+        aul::Circular_array<int, aul::Remappable_allocator<int>> arr{};
+        aul::Circular_array<int, aul::Remappable_allocator<int>, aul::Power_of_two_capacity> pow2_arr{};
+
+        //Keep the elements wrapped around the end of the allocation while
+        //the containers grow
+        int first = 0;
+        for (int i = 0; i < 50000; ++i) {
+            arr.push_back(i);
+            pow2_arr.push_back(i);
+            if (i % 3 == 0) {
+                arr.pop_front();
+                pow2_arr.pop_front();
+                ++first;
+            }
+        }
+
+        ASSERT_EQ(arr.size(), 50000 - first);
+        ASSERT_EQ(pow2_arr.size(), arr.size());
+        for (std::size_t i = 0; i < arr.size(); ++i) {
+            EXPECT_EQ(arr[i], first + static_cast<int>(i));
+            EXPECT_EQ(pow2_arr[i], first + static_cast<int>(i));
+        }
+
+        //Arguments referring to the container's own elements survive growth
+        while (arr.size() != arr.capacity()) {
+            arr.push_back(0);
+        }
+        arr.push_back(arr.front());
+        EXPECT_EQ(arr.back(), first);
+
+        arr.reserve(4 * arr.capacity());
+        arr.push_front(-1);
+        EXPECT_EQ(arr.front(), -1);
+        EXPECT_EQ(arr[1], first);
+        EXPECT_EQ(arr.back(), first);
+    }
+
+    #endif
+
     //=====================================================
     // Integration
     //=====================================================
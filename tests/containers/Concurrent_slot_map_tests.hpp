@@ -0,0 +1,165 @@
+#ifndef AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
+#define AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
+
+#include <aul/containers/Concurrent_slot_map.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Concurrent_slot_map, Default_constructor) {
+        aul::Concurrent_slot_map<double> map;
+
+        EXPECT_EQ(map.size(), 0);
+        EXPECT_EQ(map.capacity(), 0);
+        EXPECT_TRUE(map.empty());
+        EXPECT_FALSE(map.contains({}));
+    }
+
+    //=====================================================
+    // Mutator tests
+    //=====================================================
+
+    TEST(Concurrent_slot_map, Emplace) {
+        aul::Concurrent_slot_map<std::string> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 1000; ++i) {
+            keys.push_back(map.emplace(std::to_string(i)));
+        }
+
+        EXPECT_EQ(map.size(), 1000);
+
+        for (int i = 0; i < 1000; ++i) {
+            EXPECT_EQ(map[keys[i]], std::to_string(i));
+        }
+    }
+
+    TEST(Concurrent_slot_map, Growth_does_not_move_elements) {
+        aul::Concurrent_slot_map<int> map;
+
+        auto key = map.emplace(5);
+        int* ptr = &map[key];
+
+        for (int i = 0; i < 4096; ++i) {
+            map.emplace(i);
+        }
+
+        EXPECT_EQ(&map[key], ptr);
+        EXPECT_EQ(*ptr, 5);
+    }
+
+    TEST(Concurrent_slot_map, Erase) {
+        aul::Concurrent_slot_map<std::string> map;
+
+        auto key0 = map.emplace("a");
+        auto key1 = map.emplace("b");
+
+        EXPECT_TRUE(map.erase(key0));
+        EXPECT_FALSE(map.erase(key0));
+
+        EXPECT_EQ(map.size(), 1);
+        EXPECT_FALSE(map.contains(key0));
+        EXPECT_EQ(map.find(key0), nullptr);
+        EXPECT_ANY_THROW(static_cast<void>(map.at(key0)));
+        EXPECT_EQ(map.at(key1), "b");
+
+        auto key2 = map.emplace("c");
+        EXPECT_EQ(key2.index, key0.index);
+        EXPECT_NE(key2.version, key0.version);
+        EXPECT_FALSE(map.contains(key0));
+        EXPECT_EQ(map.at(key2), "c");
+    }
+
+    TEST(Concurrent_slot_map, Even_version_keys_are_rejected) {
+        using key_type = aul::Concurrent_slot_map<std::string>::key_type;
+        aul::Concurrent_slot_map<std::string> map;
+
+        auto key0 = map.emplace("a");
+        auto key1 = map.emplace("b");
+        EXPECT_TRUE(map.erase(key0));
+
+        //Unused slot in an allocated chunk
+        const key_type unused{key1.index + 1, 0};
+        EXPECT_FALSE(map.contains(unused));
+        EXPECT_EQ(map.find(unused), nullptr);
+        EXPECT_FALSE(map.erase(unused));
+
+        //Vacated slot, with the version it was given on erasure
+        const key_type stale{key0.index, key0.version + 1};
+        EXPECT_FALSE(map.contains(stale));
+        EXPECT_FALSE(map.erase(stale));
+
+        EXPECT_EQ(map.size(), 1);
+        EXPECT_EQ(map.at(key1), "b");
+
+        auto key2 = map.emplace("c");
+        EXPECT_EQ(map.at(key2), "c");
+        EXPECT_EQ(map.size(), 2);
+    }
+
+    //=====================================================
+    // Concurrency tests
+    //=====================================================
+
+    TEST(Concurrent_slot_map, Concurrent_emplace_and_erase) {
+        constexpr int thread_count = 4;
+        constexpr int per_thread = 2000;
+
+        aul::Concurrent_slot_map<int> map;
+        std::vector<std::vector<decltype(map)::key_type>> keys(thread_count);
+        std::atomic<bool> done{false};
+
+        std::thread reader{[&] () {
+            decltype(map)::key_type key{0, 1};
+            while (!done.load()) {
+                static_cast<void>(map.contains(key));
+                key.index = (key.index + 1) % (thread_count * per_thread);
+            }
+        }};
+
+        std::vector<std::thread> writers;
+        for (int t = 0; t < thread_count; ++t) {
+            writers.emplace_back([&, t] () {
+                for (int i = 0; i < per_thread; ++i) {
+                    keys[t].push_back(map.emplace(t * per_thread + i));
+                }
+
+                for (int i = 0; i < per_thread; i += 2) {
+                    EXPECT_TRUE(map.erase(keys[t][i]));
+                }
+            });
+        }
+
+        for (auto& writer : writers) {
+            writer.join();
+        }
+
+        done.store(true);
+        reader.join();
+
+        EXPECT_EQ(map.size(), thread_count * per_thread / 2);
+
+        for (int t = 0; t < thread_count; ++t) {
+            for (int i = 0; i < per_thread; ++i) {
+                if (i % 2) {
+                    EXPECT_EQ(map.at(keys[t][i]), t * per_thread + i);
+                } else {
+                    EXPECT_FALSE(map.contains(keys[t][i]));
+                }
+            }
+        }
+    }
+
+}
+
+#endif //AUL_CONCURRENT_SLOT_MAP_TESTS_HPP
@@ -0,0 +1,182 @@
+#ifndef AUL_MPMC_CIRCULAR_ARRAY_TESTS_HPP
+#define AUL_MPMC_CIRCULAR_ARRAY_TESTS_HPP
+
+#include <aul/containers/Mpmc_circular_array.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Mpmc_circular_array, Capacity_is_power_of_two) {
+        aul::Mpmc_circular_array<int> queue0{0};
+        EXPECT_EQ(queue0.capacity(), 2);
+
+        aul::Mpmc_circular_array<int> queue1{100};
+        EXPECT_EQ(queue1.capacity(), 128);
+        EXPECT_TRUE(queue1.empty());
+    }
+
+    TEST(Mpmc_circular_array, Capacity_of_one) {
+        aul::Mpmc_circular_array<std::string> queue{1};
+        EXPECT_EQ(queue.capacity(), 2);
+
+        EXPECT_TRUE(queue.try_push("a"));
+        EXPECT_TRUE(queue.try_push("b"));
+        EXPECT_FALSE(queue.try_push("c"));
+        EXPECT_EQ(queue.size(), 2);
+
+        std::string out;
+        EXPECT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out, "a");
+        EXPECT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out, "b");
+        EXPECT_FALSE(queue.try_pop(out));
+        EXPECT_TRUE(queue.empty());
+    }
+
+    //=====================================================
+    // Single-threaded tests
+    //=====================================================
+
+    TEST(Mpmc_circular_array, Push_pop) {
+        aul::Mpmc_circular_array<std::string> queue{4};
+
+        EXPECT_TRUE(queue.try_push("a"));
+        EXPECT_TRUE(queue.try_push(std::string{"b"}));
+        EXPECT_TRUE(queue.try_emplace(3, 'c'));
+        EXPECT_TRUE(queue.try_push("d"));
+        EXPECT_FALSE(queue.try_push("e"));
+        EXPECT_EQ(queue.size(), 4);
+
+        std::string out;
+        EXPECT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out, "a");
+        EXPECT_TRUE(queue.try_pop(out));
+        EXPECT_EQ(out, "b");
+
+        //Wrap around the end of the allocation
+        EXPECT_TRUE(queue.try_push("e"));
+        EXPECT_TRUE(queue.try_push("f"));
+        EXPECT_FALSE(queue.try_push("g"));
+
+        const char* expected[] = {"ccc", "d", "e", "f"};
+        for (const char* e : expected) {
+            EXPECT_TRUE(queue.try_pop(out));
+            EXPECT_EQ(out, e);
+        }
+
+        EXPECT_FALSE(queue.try_pop(out));
+        EXPECT_TRUE(queue.empty());
+
+        //Remaining elements are destroyed by the destructor
+        EXPECT_TRUE(queue.try_push("h"));
+    }
+
+    TEST(Mpmc_circular_array, Push_bulk) {
+        aul::Mpmc_circular_array<int> queue{8};
+
+        std::vector<int> source(12);
+        std::iota(source.begin(), source.end(), 0);
+
+        EXPECT_EQ(queue.push_bulk(source.begin(), 5), 5);
+
+        int out = 0;
+        for (int i = 0; i < 3; ++i) {
+            EXPECT_TRUE(queue.try_pop(out));
+            EXPECT_EQ(out, i);
+        }
+
+        EXPECT_EQ(queue.push_bulk(source.begin() + 5, 7), 6);
+        EXPECT_EQ(queue.push_bulk(source.begin() + 11, 1), 0);
+
+        for (int i = 3; i < 11; ++i) {
+            EXPECT_TRUE(queue.try_pop(out));
+            EXPECT_EQ(out, i);
+        }
+        EXPECT_FALSE(queue.try_pop(out));
+
+        std::vector<std::string> strings{"x", "y", "z"};
+        aul::Mpmc_circular_array<std::string> string_queue{2};
+        EXPECT_EQ(string_queue.push_bulk(strings.begin(), strings.size()), 2);
+    }
+
+    //=====================================================
+    // Multi-threaded tests
+    //=====================================================
+
+    TEST(Mpmc_circular_array, Producers_consumers) {
+        constexpr int thread_count = 3;
+        constexpr int per_thread = 50000;
+
+        aul::Mpmc_circular_array<int> queue{64};
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < thread_count; ++p) {
+            producers.emplace_back([&queue, p] {
+                int batch[4];
+                int i = 0;
+                while (i < per_thread) {
+                    if (i % 8 == 0 && per_thread - i >= 4) {
+                        std::iota(batch, batch + 4, p * per_thread + i);
+                        i += static_cast<int>(queue.push_bulk(batch, 4));
+                    } else if (queue.try_push(p * per_thread + i)) {
+                        ++i;
+                    } else {
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+
+        std::vector<std::vector<int>> received(thread_count);
+        std::vector<std::thread> consumers;
+        for (int c = 0; c < thread_count; ++c) {
+            consumers.emplace_back([&queue, &received, c] {
+                std::vector<int> last(thread_count, -1);
+                int value = 0;
+                while (received[c].size() < per_thread) {
+                    if (!queue.try_pop(value)) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+
+                    //Each producer's elements arrive in order
+                    const int p = value / per_thread;
+                    EXPECT_LT(last[p], value);
+                    last[p] = value;
+
+                    received[c].push_back(value);
+                }
+            });
+        }
+
+        for (auto& t : producers) {
+            t.join();
+        }
+        for (auto& t : consumers) {
+            t.join();
+        }
+
+        std::vector<char> seen(thread_count * per_thread, 0);
+        for (const auto& r : received) {
+            for (int v : r) {
+                EXPECT_EQ(seen[v], 0);
+                seen[v] = 1;
+            }
+        }
+        EXPECT_EQ(std::accumulate(seen.begin(), seen.end(), 0), thread_count * per_thread);
+        EXPECT_TRUE(queue.empty());
+    }
+
+}
+
+#endif //AUL_MPMC_CIRCULAR_ARRAY_TESTS_HPP
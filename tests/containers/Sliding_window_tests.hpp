@@ -0,0 +1,123 @@
+#ifndef AUL_SLIDING_WINDOW_TESTS_HPP
+#define AUL_SLIDING_WINDOW_TESTS_HPP
+
+#include <aul/containers/Sliding_window.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace aul::tests {
+
+    struct Sliding_window_min {
+        int operator()(const int a, const int b) const {
+            return std::min(a, b);
+        }
+    };
+
+    TEST(Sliding_window, Sum_over_last_n) {
+        aul::Sliding_window<int> window{4};
+
+        EXPECT_TRUE(window.empty());
+        EXPECT_EQ(window.capacity(), 4);
+        EXPECT_THROW(aul::Sliding_window<int>{0}, std::length_error);
+
+        for (int i = 1; i <= 20; ++i) {
+            window.push(i);
+
+            const int first = std::max(1, i - 3);
+            EXPECT_EQ(window.size(), static_cast<std::size_t>(i - first + 1));
+            EXPECT_EQ(window.front(), first);
+            EXPECT_EQ(window.back(), i);
+            EXPECT_EQ(window.aggregate(), (first + i) * (i - first + 1) / 2);
+        }
+
+        EXPECT_TRUE(window.full());
+        window.pop();
+        window.pop();
+        EXPECT_EQ(window.aggregate(), 19 + 20);
+
+        window.clear();
+        EXPECT_TRUE(window.empty());
+        window.push(5);
+        EXPECT_EQ(window.aggregate(), 5);
+    }
+
+    TEST(Sliding_window, Matches_recomputation) {
+        std::mt19937 gen{42};
+        std::uniform_int_distribution<int> values{-1000, 1000};
+
+        for (std::size_t n : {1, 2, 7, 64}) {
+            aul::Sliding_window<int, Sliding_window_min> window{n};
+            std::deque<int> expected;
+
+            auto push_expected = [&] (int v) {
+                expected.push_back(v);
+                if (expected.size() > n) {
+                    expected.pop_front();
+                }
+            };
+
+            for (int i = 0; i < 2000; ++i) {
+                switch (gen() % 4) {
+                    case 0:
+                    case 1: {
+                        const int v = values(gen);
+                        window.push(v);
+                        push_expected(v);
+                        break;
+                    }
+                    case 2: {
+                        std::vector<int> block(gen() % (2 * n + 1));
+                        for (int& v : block) {
+                            v = values(gen);
+                            push_expected(v);
+                        }
+                        window.push(block.begin(), block.end());
+                        break;
+                    }
+                    default: {
+                        const std::size_t k = gen() % (expected.size() + 1);
+                        window.pop_n(k);
+                        expected.erase(expected.begin(), expected.begin() + k);
+                        break;
+                    }
+                }
+
+                ASSERT_EQ(window.size(), expected.size());
+                if (expected.empty()) {
+                    continue;
+                }
+
+                ASSERT_EQ(window.front(), expected.front());
+                ASSERT_EQ(window.back(), expected.back());
+                ASSERT_EQ(window.aggregate(), *std::min_element(expected.begin(), expected.end()));
+            }
+        }
+    }
+
+    TEST(Sliding_window, Non_commutative_operation) {
+        aul::Sliding_window<std::string> window{3};
+
+        for (char c = 'a'; c <= 'g'; ++c) {
+            window.push(std::string(1, c));
+        }
+        EXPECT_EQ(window.aggregate(), "efg");
+
+        window.pop();
+        EXPECT_EQ(window.aggregate(), "fg");
+
+        std::vector<std::string> block{"h", "i"};
+        window.push(block.begin(), block.end());
+        EXPECT_EQ(window.aggregate(), "ghi");
+        EXPECT_EQ(window[0], "g");
+        EXPECT_EQ(window[2], "i");
+    }
+
+}
+
+#endif //AUL_SLIDING_WINDOW_TESTS_HPP
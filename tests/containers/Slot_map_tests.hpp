@@ -5,6 +5,24 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <cstdio>
+#include <cstdlib>
+
+#include <unistd.h>
+#endif
+
 namespace aul::tests {
 
     //=====================================================
@@ -168,6 +186,593 @@ namespace aul::tests {
         EXPECT_TRUE(map.empty());
     }
 
+    TEST(Slot_map, Erase_key_out_of_order) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        EXPECT_TRUE(map.erase(keys[0]));
+        EXPECT_TRUE(map.erase(keys[7]));
+        EXPECT_TRUE(map.erase(keys[3]));
+        EXPECT_FALSE(map.erase(keys[3]));
+
+        EXPECT_EQ(map.size(), 5);
+        EXPECT_FALSE(map.contains(keys[0]));
+        EXPECT_FALSE(map.contains(keys[3]));
+        EXPECT_FALSE(map.contains(keys[7]));
+
+        for (int i : {1, 2, 4, 5, 6}) {
+            EXPECT_EQ(map.at(keys[i]), i);
+        }
+    }
+
+    //=====================================================
+    // Bulk operations
+    //=====================================================
+
+    TEST(Slot_map, Emplace_n) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        map.emplace_n(100, std::back_inserter(keys), 7);
+
+        EXPECT_EQ(map.size(), 100);
+        EXPECT_EQ(keys.size(), 100);
+
+        for (auto key : keys) {
+            EXPECT_EQ(map.at(key), 7);
+        }
+
+        map.emplace_n(0, std::back_inserter(keys), 7);
+        EXPECT_EQ(map.size(), 100);
+    }
+
+    TEST(Slot_map, Insert_range) {
+        aul::Slot_map<std::string> map;
+        std::vector<std::string> values{"a", "b", "c", "d", "e"};
+        std::vector<decltype(map)::key_type> keys(values.size());
+
+        auto key = map.emplace("z");
+        auto end = map.insert(values.begin(), values.end(), keys.begin());
+
+        EXPECT_EQ(end, keys.end());
+        EXPECT_EQ(map.size(), 6);
+        EXPECT_EQ(map.at(key), "z");
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(map.at(keys[i]), values[i]);
+        }
+    }
+
+    TEST(Slot_map, Erase_keys) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 16; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        std::vector<decltype(map)::key_type> to_erase{
+            keys[0], keys[15], keys[3], keys[14], keys[3], keys[8], {}
+        };
+
+        EXPECT_EQ(map.erase(aul::Span<const decltype(map)::key_type>{to_erase.data(), to_erase.size()}), 5);
+        EXPECT_EQ(map.size(), 11);
+
+        for (int i = 0; i < 16; ++i) {
+            bool erased = (i == 0) || (i == 3) || (i == 8) || (i == 14) || (i == 15);
+            EXPECT_EQ(map.contains(keys[i]), !erased);
+            if (!erased) {
+                EXPECT_EQ(map[keys[i]], i);
+            }
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+    }
+
+    TEST(Slot_map, Erase_keys_then_emplace_n) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+        map.emplace_n(32, std::back_inserter(keys), 1);
+
+        EXPECT_EQ(map.erase(aul::Span<const decltype(map)::key_type>{keys.data(), keys.size()}), 32);
+        EXPECT_TRUE(map.empty());
+
+        std::vector<decltype(map)::key_type> new_keys;
+        map.emplace_n(40, std::back_inserter(new_keys), 2);
+
+        EXPECT_EQ(map.size(), 40);
+        for (auto key : keys) {
+            EXPECT_FALSE(map.contains(key));
+        }
+
+        for (auto key : new_keys) {
+            EXPECT_EQ(map.at(key), 2);
+        }
+    }
+
+    //=====================================================
+    // Structure-of-arrays specialization
+    //=====================================================
+
+    TEST(Slot_map, SoA_emplace) {
+        aul::Slot_map<std::tuple<int, double, std::string>> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 50; ++i) {
+            keys.push_back(map.emplace(i, i * 0.5, std::to_string(i)));
+        }
+
+        EXPECT_EQ(map.size(), 50);
+
+        for (int i = 0; i < 50; ++i) {
+            auto [a, b, c] = map.at(keys[i]);
+            EXPECT_EQ(a, i);
+            EXPECT_EQ(b, i * 0.5);
+            EXPECT_EQ(c, std::to_string(i));
+        }
+
+        auto ints = map.column<0>();
+        EXPECT_EQ(ints.size(), 50);
+        for (int i = 0; i < 50; ++i) {
+            EXPECT_EQ(ints[i], i);
+        }
+    }
+
+    TEST(Slot_map, SoA_views) {
+        aul::Slot_map<std::tuple<int, float, char>> map;
+        map.insert({1, 1.5f, 'a'});
+        map.insert({2, 2.5f, 'b'});
+        map.insert({3, 3.5f, 'c'});
+
+        int sum = 0;
+        for (auto [i, c] : map.columns<0, 2>()) {
+            sum += i;
+            c = 'z';
+        }
+        EXPECT_EQ(sum, 6);
+
+        for (auto [i, f, c] : map) {
+            EXPECT_EQ(f, i + 0.5f);
+            EXPECT_EQ(c, 'z');
+        }
+
+        EXPECT_EQ(map.end() - map.begin(), 3);
+    }
+
+    TEST(Slot_map, SoA_erase) {
+        aul::Slot_map<std::tuple<int, std::string>> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 8; ++i) {
+            keys.push_back(map.emplace(i, std::to_string(i)));
+        }
+
+        EXPECT_TRUE(map.erase(keys[2]));
+        EXPECT_FALSE(map.erase(keys[2]));
+        map.erase(map.cbegin());
+
+        EXPECT_EQ(map.size(), 6);
+        EXPECT_FALSE(map.contains(keys[0]));
+        EXPECT_FALSE(map.contains(keys[2]));
+
+        for (int i : {1, 3, 4, 5, 6, 7}) {
+            auto [a, b] = map.at(keys[i]);
+            EXPECT_EQ(a, i);
+            EXPECT_EQ(b, std::to_string(i));
+        }
+
+        for (auto it = map.cbegin(); it != map.cend(); ++it) {
+            auto [a, b] = *it;
+            EXPECT_EQ(b, std::to_string(a));
+            EXPECT_EQ(std::get<0>(map[map.get_key(it)]), a);
+        }
+
+        auto key = map.emplace(100, "100");
+        EXPECT_EQ(std::get<1>(map.at(key)), "100");
+    }
+
+    TEST(Slot_map, SoA_copy) {
+        aul::Slot_map<std::tuple<int, std::string>> map0;
+        auto key = map0.emplace(1, "one");
+        map0.emplace(2, "two");
+
+        aul::Slot_map<std::tuple<int, std::string>> map1{map0};
+        EXPECT_EQ(map0, map1);
+        EXPECT_EQ(std::get<1>(map1.at(key)), "one");
+
+        aul::Slot_map<std::tuple<int, std::string>> map2{std::move(map0)};
+        EXPECT_TRUE(map0.empty());
+        EXPECT_EQ(map1, map2);
+    }
+
+    //=====================================================
+    // Packed keys
+    //=====================================================
+
+    static_assert(sizeof(aul::Packed_slot_map_key<std::uint32_t, 20, 12>) == sizeof(std::uint32_t));
+
+    TEST(Slot_map, Packed_key) {
+        using key_type = aul::Packed_slot_map_key<std::uint32_t, 20, 12>;
+        aul::Slot_map<int, std::allocator<int>, key_type> map;
+        std::vector<key_type> keys;
+
+        for (int i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        EXPECT_TRUE(map.erase(keys[10]));
+        EXPECT_FALSE(map.contains(keys[10]));
+        EXPECT_FALSE(map.contains(key_type{}));
+
+        for (int i = 0; i < 100; ++i) {
+            if (i != 10) {
+                EXPECT_EQ(map.at(keys[i]), i);
+            }
+        }
+
+        EXPECT_LE(map.max_size(), key_type::max_index);
+    }
+
+    TEST(Slot_map, Packed_key_version_retirement) {
+        using key_type = aul::Packed_slot_map_key<std::uint16_t, 12, 4>;
+        aul::Slot_map<int, std::allocator<int>, key_type> map;
+
+        std::vector<key_type> old_keys;
+        for (int i = 0; i < 64; ++i) {
+            auto key = map.emplace(i);
+            old_keys.push_back(key);
+            EXPECT_EQ(map.at(key), i);
+            map.erase(key);
+        }
+
+        EXPECT_TRUE(map.empty());
+
+        for (auto key : old_keys) {
+            EXPECT_FALSE(map.contains(key));
+        }
+
+        std::vector<key_type> keys;
+        for (int i = 0; i < 32; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        for (int i = 0; i < 32; ++i) {
+            EXPECT_EQ(map.at(keys[i]), i);
+        }
+
+        for (auto key : old_keys) {
+            EXPECT_FALSE(map.contains(key));
+        }
+    }
+
+    //=====================================================
+    // Reordering
+    //=====================================================
+
+    TEST(Slot_map, Reorder) {
+        aul::Slot_map<std::string> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 6; ++i) {
+            keys.push_back(map.emplace(std::to_string(i)));
+        }
+
+        std::vector<std::size_t> permutation{2, 0, 1, 5, 4, 3};
+        map.reorder(aul::Span<const std::size_t>{permutation.size(), permutation.data()});
+
+        std::vector<std::string> expected{"2", "0", "1", "5", "4", "3"};
+        EXPECT_TRUE(std::equal(map.begin(), map.end(), expected.begin(), expected.end()));
+
+        for (int i = 0; i < 6; ++i) {
+            EXPECT_EQ(map.at(keys[i]), std::to_string(i));
+        }
+
+        for (auto it = map.begin(); it != map.end(); ++it) {
+            EXPECT_EQ(map[map.get_key(it)], *it);
+        }
+    }
+
+    struct Throwing_reorder_element {
+        static inline int moves_left = 0;
+
+        explicit Throwing_reorder_element(int v): v(v) {}
+
+        Throwing_reorder_element(Throwing_reorder_element&& other): v(other.v) {
+            count_move();
+        }
+
+        Throwing_reorder_element& operator=(Throwing_reorder_element&& other) {
+            count_move();
+            v = other.v;
+            return *this;
+        }
+
+        static void count_move() {
+            if (--moves_left == 0) {
+                throw std::runtime_error("Throwing_reorder_element");
+            }
+        }
+
+        int v;
+    };
+
+    TEST(Slot_map, Reorder_noexcept) {
+        std::vector<std::size_t> permutation;
+        aul::Span<const std::size_t> span{permutation.size(), permutation.data()};
+
+        EXPECT_TRUE(noexcept(std::declval<aul::Slot_map<int>&>().reorder(span)));
+        EXPECT_FALSE(noexcept(std::declval<aul::Slot_map<Throwing_reorder_element>&>().reorder(span)));
+    }
+
+    TEST(Slot_map, Reorder_throwing_move) {
+        std::vector<std::size_t> permutation{2, 0, 1, 5, 4, 3};
+
+        for (int throw_at = 1; throw_at < 10; ++throw_at) {
+            aul::Slot_map<Throwing_reorder_element> map;
+            std::vector<decltype(map)::key_type> keys;
+            for (int i = 0; i < 6; ++i) {
+                keys.push_back(map.emplace(i));
+            }
+
+            Throwing_reorder_element::moves_left = throw_at;
+            EXPECT_THROW(
+                map.reorder(aul::Span<const std::size_t>{permutation.size(), permutation.data()}),
+                std::runtime_error
+            );
+            Throwing_reorder_element::moves_left = 0;
+
+            //Every key still maps to a distinct element of the container
+            std::vector<const Throwing_reorder_element*> addresses;
+            for (auto key : keys) {
+                ASSERT_TRUE(map.contains(key));
+                addresses.push_back(&map[key]);
+            }
+            std::sort(addresses.begin(), addresses.end());
+            EXPECT_EQ(std::unique(addresses.begin(), addresses.end()), addresses.end());
+
+            for (auto it = map.begin(); it != map.end(); ++it) {
+                EXPECT_EQ(&map[map.get_key(it)], &*it);
+            }
+        }
+    }
+
+    TEST(Slot_map, Sort) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace((i * 37) % 100));
+        }
+
+        for (int i = 0; i < 100; i += 3) {
+            map.erase(keys[i]);
+        }
+
+        map.sort();
+        EXPECT_TRUE(std::is_sorted(map.begin(), map.end()));
+
+        for (int i = 0; i < 100; ++i) {
+            if (i % 3) {
+                EXPECT_EQ(map.at(keys[i]), (i * 37) % 100);
+            } else {
+                EXPECT_FALSE(map.contains(keys[i]));
+            }
+        }
+
+        map.sort(std::greater<>{});
+        EXPECT_TRUE(std::is_sorted(map.begin(), map.end(), std::greater<>{}));
+
+        auto key = map.emplace(1000);
+        EXPECT_EQ(map.at(key), 1000);
+        EXPECT_EQ(map.at(keys[1]), 37);
+    }
+
+    TEST(Slot_map, Contains_many) {
+        aul::Slot_map<int> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 150; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        for (int i = 0; i < 150; i += 3) {
+            map.erase(keys[i]);
+        }
+
+        keys.emplace_back(1000, 1);
+        keys.emplace_back(std::size_t(1) << 40, 1);
+        keys.emplace_back();
+
+        std::vector<std::uint64_t> bitmask((keys.size() + 63) / 64);
+        map.contains_many(aul::Span<const decltype(map)::key_type>{keys.data(), keys.size()}, aul::Span<std::uint64_t>{bitmask.data(), bitmask.size()});
+
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(bool((bitmask[i / 64] >> (i % 64)) & 0x01), map.contains(keys[i]));
+        }
+    }
+
+    TEST(Slot_map, Resolve_many) {
+        aul::Slot_map<int, std::allocator<int>, aul::Packed_slot_map_key<std::uint32_t, 20>> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (int i = 0; i < 70; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        for (int i = 0; i < 70; i += 5) {
+            map.erase(keys[i]);
+        }
+
+        std::vector<int*> pointers(keys.size());
+        map.resolve_many(aul::Span<const decltype(map)::key_type>{keys.data(), keys.size()}, aul::Span<int*>{pointers.data(), pointers.size()});
+
+        for (std::size_t i = 0; i < keys.size(); ++i) {
+            if (i % 5) {
+                ASSERT_NE(pointers[i], nullptr);
+                EXPECT_EQ(*pointers[i], int(i));
+            } else {
+                EXPECT_EQ(pointers[i], nullptr);
+            }
+        }
+    }
+
+    #if defined(__linux__)
+
+    TEST(Slot_map, Image_round_trip) {
+        aul::Slot_map<std::uint64_t> map;
+        std::vector<decltype(map)::key_type> keys;
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i * i));
+        }
+
+        for (int i = 0; i < 100; i += 4) {
+            map.erase(keys[i]);
+        }
+
+        char path[] = "/tmp/aul_slot_map_image_XXXXXX";
+        const int fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+
+        map.write_image(fd);
+        ::close(fd);
+
+        auto loaded = aul::Slot_map<std::uint64_t>::map_image(path);
+        std::remove(path);
+
+        EXPECT_EQ(loaded.size(), map.size());
+        EXPECT_EQ(loaded.capacity(), map.capacity());
+        EXPECT_TRUE(std::equal(map.begin(), map.end(), loaded.begin(), loaded.end()));
+
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            if (i % 4) {
+                EXPECT_EQ(loaded.at(keys[i]), i * i);
+            } else {
+                EXPECT_FALSE(loaded.contains(keys[i]));
+            }
+        }
+
+        //Reuses erased anchors, then forces growth out of the mapping
+        for (std::uint64_t i = 0; i < 200; ++i) {
+            keys.push_back(loaded.emplace(i));
+        }
+
+        EXPECT_EQ(loaded.size(), 275);
+        EXPECT_EQ(loaded.at(keys[99]), 99 * 99);
+        EXPECT_EQ(loaded.at(keys.back()), 199);
+    }
+
+    TEST(Slot_map, Image_rejects_invalid_file) {
+        char path[] = "/tmp/aul_slot_map_image_XXXXXX";
+        const int fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+
+        const char garbage[128] = "not an image";
+        ASSERT_EQ(::write(fd, garbage, sizeof(garbage)), ssize_t(sizeof(garbage)));
+        ::close(fd);
+
+        EXPECT_THROW(aul::Slot_map<std::uint64_t>::map_image(path), std::runtime_error);
+        std::remove(path);
+    }
+
+    TEST(Slot_map, Image_rejects_truncated_file) {
+        aul::Slot_map<std::uint64_t> map;
+        map.reserve(1024);
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            map.emplace(i);
+        }
+
+        char path[] = "/tmp/aul_slot_map_image_XXXXXX";
+        const int fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+
+        map.write_image(fd);
+        ASSERT_EQ(::ftruncate(fd, 200), 0);
+        ::close(fd);
+
+        EXPECT_THROW(aul::Slot_map<std::uint64_t>::map_image(path), std::runtime_error);
+        std::remove(path);
+    }
+
+    TEST(Slot_map, Image_rejects_out_of_range_anchor_index) {
+        aul::Slot_map<std::uint64_t> map;
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            map.emplace(i);
+        }
+
+        char path[] = "/tmp/aul_slot_map_image_XXXXXX";
+        const int fd = ::mkstemp(path);
+        ASSERT_NE(fd, -1);
+
+        map.write_image(fd);
+
+        //The image ends with the metadata array, whose entries consist of an
+        //anchor index followed by the anchor
+        using size_type = decltype(map)::size_type;
+        const off_t entry_size = sizeof(size_type) + sizeof(aul::Versioned_type<size_type, size_type>);
+        const off_t file_size = ::lseek(fd, 0, SEEK_END);
+        const auto bad_index = std::numeric_limits<size_type>::max();
+        ASSERT_EQ(::pwrite(fd, &bad_index, sizeof(bad_index), file_size - entry_size), ssize_t(sizeof(bad_index)));
+        ::close(fd);
+
+        EXPECT_THROW(aul::Slot_map<std::uint64_t>::map_image(path), std::runtime_error);
+        std::remove(path);
+    }
+
+    TEST(Slot_map, Image_rejects_garbled_anchor_table) {
+        aul::Slot_map<std::uint64_t> map;
+        std::vector<decltype(map)::key_type> keys;
+        for (std::uint64_t i = 0; i < 100; ++i) {
+            keys.push_back(map.emplace(i));
+        }
+
+        //Free list runs keys[8] -> keys[4] -> keys[0] -> unused anchors
+        map.erase(keys[0]);
+        map.erase(keys[4]);
+        map.erase(keys[8]);
+
+        //Each metadata entry consists of an anchor index followed by the
+        //anchor, whose first member is the position it points to
+        using size_type = decltype(map)::size_type;
+        const off_t entry_size = sizeof(size_type) + sizeof(aul::Versioned_type<size_type, size_type>);
+
+        const auto expect_rejected = [&] (const size_type anchor_index, const size_type data) {
+            char path[] = "/tmp/aul_slot_map_image_XXXXXX";
+            const int fd = ::mkstemp(path);
+            ASSERT_NE(fd, -1);
+
+            map.write_image(fd);
+
+            const off_t metadata_offset = ::lseek(fd, 0, SEEK_END) - off_t(map.capacity()) * entry_size;
+            const off_t data_offset = metadata_offset + off_t(anchor_index) * entry_size + off_t(sizeof(size_type));
+            ASSERT_EQ(::pwrite(fd, &data, sizeof(data), data_offset), ssize_t(sizeof(data)));
+            ::close(fd);
+
+            EXPECT_THROW(aul::Slot_map<std::uint64_t>::map_image(path), std::runtime_error);
+            std::remove(path);
+        };
+
+        //Anchor of an element pointing past the elements
+        expect_rejected(keys[50].index, map.size() + 1);
+
+        //Free list link out of range
+        expect_rejected(keys[8].index, std::numeric_limits<size_type>::max());
+
+        //Free list which cycles
+        expect_rejected(keys[4].index, keys[8].index);
+
+        //Free list ending early, leaving anchors unaccounted for
+        expect_rejected(keys[8].index, keys[8].index);
+    }
+
+    #endif
+
 }
 
 #endif //AUL_SLOT_MAP_TESTS_HPP
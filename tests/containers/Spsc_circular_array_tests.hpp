@@ -0,0 +1,130 @@
+#ifndef AUL_SPSC_CIRCULAR_ARRAY_TESTS_HPP
+#define AUL_SPSC_CIRCULAR_ARRAY_TESTS_HPP
+
+#include <aul/containers/Spsc_circular_array.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace aul::tests {
+
+    //=====================================================
+    // -ctors
+    //=====================================================
+
+    TEST(Spsc_circular_array, Capacity_is_power_of_two) {
+        aul::Spsc_circular_array<int> ring0{0};
+        EXPECT_EQ(ring0.capacity(), 1);
+
+        aul::Spsc_circular_array<int> ring1{100};
+        EXPECT_EQ(ring1.capacity(), 128);
+        EXPECT_TRUE(ring1.empty());
+    }
+
+    //=====================================================
+    // Single-threaded tests
+    //=====================================================
+
+    TEST(Spsc_circular_array, Push_pop) {
+        aul::Spsc_circular_array<std::string> ring{4};
+
+        EXPECT_TRUE(ring.try_push("a"));
+        EXPECT_TRUE(ring.try_push(std::string{"b"}));
+        EXPECT_TRUE(ring.try_emplace(3, 'c'));
+        EXPECT_TRUE(ring.try_push("d"));
+        EXPECT_FALSE(ring.try_push("e"));
+        EXPECT_EQ(ring.size(), 4);
+
+        std::string out;
+        EXPECT_TRUE(ring.try_pop(out));
+        EXPECT_EQ(out, "a");
+        EXPECT_TRUE(ring.try_push("e"));
+
+        std::vector<std::string> expected{"b", "ccc", "d", "e"};
+        for (const auto& e : expected) {
+            ASSERT_TRUE(ring.try_pop(out));
+            EXPECT_EQ(out, e);
+        }
+        EXPECT_FALSE(ring.try_pop(out));
+
+        //Leave elements behind for the destructor
+        ring.try_push("f");
+        ring.try_push("g");
+    }
+
+    TEST(Spsc_circular_array, Bulk_transfer_wraps_around) {
+        aul::Spsc_circular_array<int> ring{8};
+
+        std::vector<int> source(20);
+        std::iota(source.begin(), source.end(), 0);
+
+        EXPECT_EQ(ring.push_n(source.data(), 6), 6);
+
+        std::vector<int> dest(20, -1);
+        EXPECT_EQ(ring.pop_n(dest.data(), 5), 5);
+
+        //Wraps around the end of the allocation
+        EXPECT_EQ(ring.push_n(source.data() + 6, 14), 7);
+        EXPECT_EQ(ring.size(), 8);
+        EXPECT_EQ(ring.push_n(source.data() + 13, 1), 0);
+
+        EXPECT_EQ(ring.pop_n(dest.data() + 5, 20), 8);
+        EXPECT_TRUE(ring.empty());
+
+        for (int i = 0; i < 13; ++i) {
+            EXPECT_EQ(dest[i], i);
+        }
+    }
+
+    //=====================================================
+    // Multi-threaded tests
+    //=====================================================
+
+    TEST(Spsc_circular_array, Producer_consumer) {
+        constexpr int count = 200000;
+        aul::Spsc_circular_array<int> ring{64};
+
+        std::thread producer{[&] () {
+            std::vector<int> block(10);
+            for (int i = 0; i < count;) {
+                if (i % 3 == 0) {
+                    if (ring.try_push(i)) {
+                        ++i;
+                    }
+                } else {
+                    const int n = std::min<int>(block.size(), count - i);
+                    std::iota(block.begin(), block.begin() + n, i);
+                    i += ring.push_n(block.data(), n);
+                }
+            }
+        }};
+
+        std::vector<int> received;
+        received.reserve(count);
+
+        std::vector<int> block(16);
+        while (received.size() < count) {
+            int x;
+            if (ring.try_pop(x)) {
+                received.push_back(x);
+            }
+
+            auto n = ring.pop_n(block.data(), block.size());
+            received.insert(received.end(), block.begin(), block.begin() + n);
+        }
+
+        producer.join();
+
+        ASSERT_EQ(received.size(), count);
+        for (int i = 0; i < count; ++i) {
+            ASSERT_EQ(received[i], i);
+        }
+    }
+
+}
+
+#endif //AUL_SPSC_CIRCULAR_ARRAY_TESTS_HPP
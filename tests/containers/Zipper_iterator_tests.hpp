@@ -7,6 +7,10 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <tuple>
+#include <type_traits>
+
 #include <aul/containers/Zipper_iterator.hpp>
 
 namespace aul {
@@ -14,9 +18,9 @@ namespace aul {
     using int_it = int*;
     using float_it = float*;
 
-    using int_float_fzipit = Forward_zipperator<int*, float*>;
-    using int_float_bzipit = Bidirectional_zipperator<int*, float*>;
-    using int_float_rzipit = Random_access_zipperator<int*, float*>;
+    using int_float_fzipit = Forward_zipper_iterator<int*, float*>;
+    using int_float_bzipit = Bidirectional_zipper_iterator<int*, float*>;
+    using int_float_rzipit = Random_access_zipper_iterator<int*, float*>;
 
     //=====================================================
     // Static tests
@@ -81,7 +85,7 @@ namespace aul {
         std::array<int, 4> arr0{4, 4, 4, 4};
         std::array<int, 4> arr1{2, 2, 2, 2};
 
-        Random_access_zipperator<int*, int*> it(arr0.data(), arr1.data());
+        Random_access_zipper_iterator<int*, int*> it(arr0.data(), arr1.data());
 
         auto [a, b] = *it;
         a = 0;
@@ -91,6 +95,31 @@ namespace aul {
         EXPECT_EQ(arr1[0], 0);
     }
 
+    TEST(Zipperator, Random_access_three_iterators) {
+        std::array<int, 3> arr0{1, 2, 3};
+        std::array<float, 3> arr1{1.5f, 2.5f, 3.5f};
+        std::array<char, 3> arr2{'a', 'b', 'c'};
+
+        Random_access_zipper_iterator<int*, float*, char*> begin{arr0.data(), arr1.data(), arr2.data()};
+        Random_access_zipper_iterator<int*, float*, char*> end = begin + 3;
+
+        EXPECT_EQ(end - begin, 3);
+
+        int i = 0;
+        for (auto it = begin; it != end; ++it, ++i) {
+            auto [a, b, c] = *it;
+            EXPECT_EQ(a, arr0[i]);
+            EXPECT_EQ(b, arr1[i]);
+            EXPECT_EQ(c, arr2[i]);
+        }
+        EXPECT_EQ(i, 3);
+
+        --end;
+        EXPECT_EQ(std::get<0>(*end), 3);
+        EXPECT_EQ(std::get<2>(*end), 'c');
+        EXPECT_EQ(std::get<1>(end.operator->()), arr1.data() + 2);
+    }
+
 }
 
 #endif //AUL_ZIPPERATOR_TESTS_HPP
@@ -0,0 +1,58 @@
+#ifndef AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
+#define AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
+
+#if defined(__linux__)
+
+#include <aul/memory/Memory_mapped_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace aul::tests {
+
+    TEST(Memory_mapped_allocator, Round_size) {
+        using allocator_type = aul::Memory_mapped_allocator<std::uint32_t>;
+
+        const std::size_t page_elements = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)) / sizeof(std::uint32_t);
+        EXPECT_EQ(allocator_type::round_size(0), 0);
+        EXPECT_EQ(allocator_type::round_size(1), page_elements);
+        EXPECT_EQ(allocator_type::round_size(page_elements), page_elements);
+        EXPECT_EQ(allocator_type::round_size(page_elements + 1), 2 * page_elements);
+
+        //Element sizes which do not divide the page size
+        using odd_allocator_type = aul::Memory_mapped_allocator<char[3]>;
+        const std::size_t n = odd_allocator_type::round_size(1);
+        EXPECT_EQ((n * 3) % static_cast<std::size_t>(::sysconf(_SC_PAGESIZE)), 0);
+    }
+
+    TEST(Memory_mapped_allocator, Allocation_is_mirrored) {
+        using allocator_type = aul::Memory_mapped_allocator<std::uint32_t>;
+        allocator_type allocator{};
+
+        const std::size_t n = allocator_type::round_size(3000);
+        std::uint32_t* p = std::allocator_traits<allocator_type>::allocate(allocator, n);
+        ASSERT_NE(p, nullptr);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = static_cast<std::uint32_t>(i);
+        }
+
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(p[n + i], i);
+        }
+
+        p[n + 5] = 12345;
+        EXPECT_EQ(p[5], 12345);
+
+        std::allocator_traits<allocator_type>::deallocate(allocator, p, n);
+
+        EXPECT_EQ(std::allocator_traits<allocator_type>::allocate(allocator, 0), nullptr);
+    }
+
+}
+
+#endif
+
+#endif //AUL_MEMORY_MAPPED_ALLOCATOR_TESTS_HPP
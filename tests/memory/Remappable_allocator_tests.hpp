@@ -0,0 +1,57 @@
+#ifndef AUL_REMAPPABLE_ALLOCATOR_TESTS_HPP
+#define AUL_REMAPPABLE_ALLOCATOR_TESTS_HPP
+
+#if defined(__linux__)
+
+#include <aul/memory/Remappable_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <memory>
+
+namespace aul::tests {
+
+    TEST(Remappable_allocator, Reallocate_preserves_contents) {
+        using allocator_type = aul::Remappable_allocator<std::uint32_t>;
+        allocator_type allocator{};
+
+        const std::size_t n = 3000;
+        std::uint32_t* p = std::allocator_traits<allocator_type>::allocate(allocator, n);
+        ASSERT_NE(p, nullptr);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            p[i] = static_cast<std::uint32_t>(i);
+        }
+
+        const std::size_t m = 1000000;
+        p = allocator.reallocate(p, n, m);
+        ASSERT_NE(p, nullptr);
+
+        for (std::size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(p[i], i);
+        }
+
+        //Newly added storage is usable
+        p[m - 1] = 12345;
+        EXPECT_EQ(p[m - 1], 12345);
+
+        p = allocator.reallocate(p, m, 10);
+        ASSERT_NE(p, nullptr);
+        EXPECT_EQ(p[9], 9);
+
+        std::allocator_traits<allocator_type>::deallocate(allocator, p, 10);
+
+        p = allocator.reallocate(nullptr, 0, 5);
+        ASSERT_NE(p, nullptr);
+        p[4] = 4;
+        EXPECT_EQ(allocator.reallocate(p, 5, 0), nullptr);
+
+        EXPECT_EQ(std::allocator_traits<allocator_type>::allocate(allocator, 0), nullptr);
+    }
+
+}
+
+#endif
+
+#endif //AUL_REMAPPABLE_ALLOCATOR_TESTS_HPP